@@ -6,22 +6,67 @@
 /*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/12/09 17:46:44 by moabid            #+#    #+#             */
-/*   Updated: 2022/12/14 15:41:11 by moabid           ###   ########.fr       */
+/*   Updated: 2026/10/19 18:47:05 by moabid           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #pragma once
 
+# include "type_traits.hpp"
+# include "iterators/VectorIterator.hpp"
+# include "simd.hpp"
+
 namespace ft
 {
 	/* ------------------------------------------------------------- */
 	/**
-	*   @brief  min Returns the smaller of a and b.
+	*   @brief  contiguous_iterator Tells whether an iterator walks a plain
+	*   array (pointers, ft::vector iterators) and gives its address.
 	*/
 	/* ------------------------------------------------------------- */
 
-	template <class InputIterator1, class InputIterator2> 
-	bool	equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
+	template <class Iterator>
+	struct contiguous_iterator : public false_type { };
+
+	template <class T>
+	struct contiguous_iterator<T*> : public true_type {
+		static T*	address(T* it) { return it; }
+	};
+
+	template <class T>
+	struct contiguous_iterator<VectorIterator<T> > : public true_type {
+		static T*	address(const VectorIterator<T>& it) { return it.base(); }
+	};
+
+	/* ------------------------------------------------------------- */
+	/**
+	*   @brief  simd_comparable True when two iterators walk arrays of the
+	*   same integer or floating point type, so ft::simd kernels apply.
+	*/
+	/* ------------------------------------------------------------- */
+
+	template <class Iterator1, class Iterator2>
+	struct simd_comparable {
+		typedef typename iterator_traits<Iterator1>::value_type		value_type;
+		typedef typename iterator_traits<Iterator2>::value_type		other_type;
+
+		static const bool	value = contiguous_iterator<Iterator1>::value && contiguous_iterator<Iterator2>::value
+									&& is_same<value_type, other_type>::value
+									&& (is_integral<value_type>::value
+										|| is_same<value_type, float>::value || is_same<value_type, double>::value);
+		typedef integral_constant<bool, value>	type;
+	};
+
+	/* ------------------------------------------------------------- */
+	/**
+	*   @brief  equal Tests whether the elements in the range [first1,last1)
+	*   are equal to those starting at first2. Arrays of numbers are
+	*   compared with the ft::simd kernels.
+	*/
+	/* ------------------------------------------------------------- */
+
+	template <class InputIterator1, class InputIterator2>
+	bool	_equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, false_type)
 	{
 		for (; first1 != last1; ++first1, ++first2)
 		{
@@ -31,6 +76,19 @@ namespace ft
 		return true;
 	}
 
+	template <class InputIterator1, class InputIterator2>
+	bool	_equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, true_type)
+	{
+		return simd::equal(contiguous_iterator<InputIterator1>::address(first1),
+							contiguous_iterator<InputIterator2>::address(first2), last1 - first1);
+	}
+
+	template <class InputIterator1, class InputIterator2> 
+	bool	equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
+	{
+		return _equal(first1, last1, first2, typename simd_comparable<InputIterator1, InputIterator2>::type());
+	}
+
 	template <class InputIterator1, class InputIterator2, class BinaryPredicate>
 	bool	equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, BinaryPredicate pred)
 	{
@@ -50,8 +108,8 @@ namespace ft
     /* ------------------------------------------------------------- */
 
 	template <class InputIterator1, class InputIterator2>
-	bool	lexicographical_compare(InputIterator1 first1, InputIterator1 last1,
-									InputIterator2 first2, InputIterator2 last2) 
+	bool	_lexicographical_compare(InputIterator1 first1, InputIterator1 last1,
+									InputIterator2 first2, InputIterator2 last2, false_type) 
 	{
 		for (; (first1 != last1) && (first2 != last2); ++first1, ++first2)
 		{
@@ -62,6 +120,22 @@ namespace ft
 		}
 		return (first1 == last1) && (first2 != last2);
 	}
+
+	template <class InputIterator1, class InputIterator2>
+	bool	_lexicographical_compare(InputIterator1 first1, InputIterator1 last1,
+									InputIterator2 first2, InputIterator2 last2, true_type)
+	{
+		return simd::lexicographical_compare(contiguous_iterator<InputIterator1>::address(first1), last1 - first1,
+											contiguous_iterator<InputIterator2>::address(first2), last2 - first2);
+	}
+
+	template <class InputIterator1, class InputIterator2>
+	bool	lexicographical_compare(InputIterator1 first1, InputIterator1 last1,
+									InputIterator2 first2, InputIterator2 last2)
+	{
+		return _lexicographical_compare(first1, last1, first2, last2,
+										typename simd_comparable<InputIterator1, InputIterator2>::type());
+	}
 	
 	template <class InputIterator1, class InputIterator2, class Compare>
 	bool	lexicographical_compare(InputIterator1 first1, InputIterator1 last1,
@@ -77,11 +151,51 @@ namespace ft
 		return (first1 == last1) && (first2 != last2);
 	}
 
-	template <class T> 
-	void	swap(T& x, T& y) {
+	/* ------------------------------------------------------------- */
+	/**
+	*   @brief  has_member_swap True when T has a void T::swap(T&) member,
+	*   which is how every ft container exchanges its contents in O(1).
+	*/
+	/* ------------------------------------------------------------- */
+
+	template <class T>
+	struct has_member_swap {
+		typedef char	yes;
+		typedef char	(&no)[2];
+
+		template <class U, void (U::*)(U&)>
+		struct check { };
+
+		template <class U>
+		static yes	test(check<U, &U::swap> *);
+		template <class U>
+		static no	test(...);
+
+		static const bool	value = sizeof(test<T>(0)) == sizeof(yes);
+	};
+
+	/* ------------------------------------------------------------- */
+	/**
+	*   @brief  swap Exchanges x and y: through the member swap when T has
+	*   one, with three copies otherwise.
+	*/
+	/* ------------------------------------------------------------- */
+
+	template <class T>
+	void	_swap(T& x, T& y, true_type) {
+		x.swap(y);
+	}
+
+	template <class T>
+	void	_swap(T& x, T& y, false_type) {
 		T z = x;
 
 		x = y;
 		y = z;
 	}
+
+	template <class T> 
+	void	swap(T& x, T& y) {
+		_swap(x, y, integral_constant<bool, has_member_swap<T>::value>());
+	}
 }
@@ -0,0 +1,216 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 09:15:08 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/22 08:34:13 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+# include <new>
+# include <limits>
+# include <stddef.h>
+# include <stdint.h>
+
+namespace ft
+{
+	/**
+    * ------------------------------------------------------------- *
+    * -------------------------- FT::ARENA ------------------------ *
+    *
+    * Bump-pointer memory for objects that all die together, such as
+    * the containers of one request. allocate() moves a pointer
+    * through a chunk, and deallocate is a no-op. reset() rewinds to
+    * the first chunk and keeps every chunk, so once warm a request
+    * makes no system allocations at all. Chunks double in size,
+    * starting at chunk_size; an oversized block gets a chunk of its
+    * own. An arena is not synchronized: use one per thread.
+    *
+    * ft::arena_allocator<T> is the handle that containers hold: a
+    * pointer to the arena, copied and rebound (ft::tree rebinds it to
+    * its nodes) along with the container. Two handles are equal when
+    * they share an arena. A default-constructed handle has no arena
+    * and uses operator new/delete.
+    *
+    * Containers keep the allocator they were built with on
+    * assignment and exchange them on swap, so an element never
+    * outlives its arena by moving into a container of another one.
+    * For the same reason ft::map moves nodes (node handles, merge,
+    * set_union, split, join) only between maps of the same arena,
+    * and throws std::invalid_argument otherwise.
+    * Nothing allocated from an arena may be used after its reset.
+    * ------------------------------------------------------------- *
+    */
+
+	class arena
+	{
+		public:
+			static const size_t	default_chunk = 64 * 1024;
+
+			explicit arena(size_t chunk_size = default_chunk)
+				: _first(NULL), _current(NULL), _ptr(NULL), _end(NULL),
+				_next_size(chunk_size ? chunk_size : default_chunk), _used(0), _reserved(0) { }
+
+			~arena() { release(); }
+
+			/* ------------------------------------------------------------- */
+            /**
+            *   bytes aligned on align, a power of two. Moves on to the next
+            *   chunk, or chains a new one, when the current one is full.
+            */
+            /* ------------------------------------------------------------- */
+
+			void	*allocate(size_t bytes, size_t align) {
+				char	*p = _align(_ptr, align);
+
+				if (_current == NULL || p > _end || static_cast<size_t>(_end - p) < bytes) {
+					_advance(bytes, align);
+					p = _align(_ptr, align);
+				}
+				_ptr = p + bytes;
+				_used += bytes;
+				return p;
+			}
+
+			void	deallocate(void *, size_t) { }
+
+				// Everything handed out is forgotten, the chunks are kept
+			void	reset() {
+				_current = _first;
+				_ptr = _first ? _first->data() : NULL;
+				_end = _first ? _first->data() + _first->size : NULL;
+				_used = 0;
+			}
+
+				// Returns the chunks to the system
+			void	release() {
+				while (_first != NULL) {
+					chunk	*next = _first->next;
+
+					::operator delete(_first);
+					_first = next;
+				}
+				_current = NULL;
+				_ptr = _end = NULL;
+				_used = _reserved = 0;
+			}
+
+			size_t	used() const { return _used; }
+			size_t	reserved() const { return _reserved; }
+
+		private:
+			struct chunk
+			{
+				chunk	*next;
+				size_t	size;
+
+				char	*data() { return reinterpret_cast<char *>(this + 1); }
+			};
+
+			chunk	*_first;
+			chunk	*_current;
+			char	*_ptr;
+			char	*_end;
+			size_t	_next_size;
+			size_t	_used;
+			size_t	_reserved;
+
+			arena(const arena&);
+			arena&	operator=(const arena&);
+
+			static char	*_align(char *p, size_t align) {
+				uintptr_t	x = reinterpret_cast<uintptr_t>(p);
+
+				return reinterpret_cast<char *>((x + align - 1) & ~(static_cast<uintptr_t>(align) - 1));
+			}
+
+				// Next chunk with room for bytes, reusing those kept by reset
+			void	_advance(size_t bytes, size_t align) {
+				size_t	need = bytes + align;
+				chunk	*next = _current ? _current->next : _first;
+
+				if (next == NULL || next->size < need) {
+					size_t	size = _next_size < need ? need : _next_size;
+					chunk	*fresh = static_cast<chunk *>(::operator new(sizeof(chunk) + size));
+
+					fresh->size = size;
+					fresh->next = next;
+					if (_current)
+						_current->next = fresh;
+					else
+						_first = fresh;
+					next = fresh;
+					_reserved += size;
+					if (_next_size <= std::numeric_limits<size_t>::max() / 2)
+						_next_size *= 2;
+				}
+				_current = next;
+				_ptr = next->data();
+				_end = _ptr + next->size;
+			}
+	};
+
+	/* ------------------------------------------------------------- */
+	/* ---------------------- ARENA_ALLOCATOR ---------------------- */
+
+	template <class T>
+	class arena_allocator
+	{
+		public:
+			typedef T			value_type;
+			typedef T*			pointer;
+			typedef const T*	const_pointer;
+			typedef T&			reference;
+			typedef const T&	const_reference;
+			typedef size_t		size_type;
+			typedef ptrdiff_t	difference_type;
+
+			template <class U>
+			struct rebind { typedef arena_allocator<U> other; };
+
+			arena_allocator() : _arena(NULL) { }
+			arena_allocator(arena& a) : _arena(&a) { }
+			arena_allocator(const arena_allocator& x) : _arena(x._arena) { }
+			template <class U>
+			arena_allocator(const arena_allocator<U>& x) : _arena(x.resource()) { }
+
+			arena_allocator&	operator=(const arena_allocator& x) {
+				_arena = x._arena;
+				return *this;
+			}
+
+			pointer	allocate(size_type n, const void * = NULL) {
+				if (n > max_size())
+					throw std::bad_alloc();
+				if (_arena == NULL)
+					return static_cast<pointer>(::operator new(n * sizeof(T)));
+				return static_cast<pointer>(_arena->allocate(n * sizeof(T), alignof(T)));
+			}
+			void	deallocate(pointer p, size_type) {
+				if (_arena == NULL)
+					::operator delete(p);
+			}
+
+			size_type	max_size() const { return std::numeric_limits<size_type>::max() / sizeof(T); }
+			void		construct(pointer p, const_reference val) { new (static_cast<void *>(p)) T(val); }
+			void		destroy(pointer p) { p->~T(); }
+			pointer			address(reference x) const { return &x; }
+			const_pointer	address(const_reference x) const { return &x; }
+
+			arena*	resource() const { return _arena; }
+
+		private:
+			arena	*_arena;
+	};
+
+	template <class T, class U>
+	bool	operator==(const arena_allocator<T>& x, const arena_allocator<U>& y) { return x.resource() == y.resource(); }
+
+	template <class T, class U>
+	bool	operator!=(const arena_allocator<T>& x, const arena_allocator<U>& y) { return x.resource() != y.resource(); }
+}
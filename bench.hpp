@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:22:58 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/21 20:31:03 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+# include <sys/time.h>
+# include <stddef.h>
+# include <iostream>
+# include <iomanip>
+# include <sstream>
+# include <string>
+
+// Hardware counters (bench_counters.cpp): bench_now() reads them, and
+// bench_report() prints what the measured region counted per operation
+bool	bench_counters_open();
+void	bench_counters_close();
+void	bench_counters_read();
+void	bench_counters_report(size_t ops);
+
+// Wall-clock time in microseconds
+inline double	bench_now()
+{
+	struct timeval	tv;
+
+	bench_counters_read();
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec * 1000000.0 + tv.tv_usec;
+}
+
+// Deterministic xorshift generator so every run measures the same inputs
+inline size_t	bench_rand()
+{
+	static size_t	state = 88172645463325252ULL;
+
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return state;
+}
+
+// Keeps the compiler from discarding a computed value
+template <class T>
+inline void	bench_keep(const T& value)
+{
+	asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Regression gate (bench_gate.cpp): samples are keyed by suite title and
+// label, saved as a baseline or checked against one
+void	bench_record(const std::string& name, double ns_per_op);
+void	bench_set_title(const std::string& title);
+bool	bench_save(const char *path);
+bool	bench_check(const char *path, double threshold, double alpha);
+
+// name | total time | time per operation
+inline void	bench_report(const std::string& name, double usec, size_t ops)
+{
+	bench_record(name, ops ? usec * 1000.0 / ops : usec * 1000.0);
+	std::cout << "  " << std::left << std::setw(52) << name << std::right
+		<< std::fixed << std::setprecision(2) << std::setw(12) << usec / 1000.0 << " ms"
+		<< std::setw(14) << (ops ? usec * 1000.0 / ops : 0.0) << " ns/op" << std::endl;
+	bench_counters_report(ops);
+}
+
+inline void	bench_title(const std::string& title, size_t n)
+{
+	std::ostringstream	key;
+
+	key << title << " (n = " << n << ")";
+	bench_set_title(key.str());
+	std::cout << "\n" << title << " (n = " << n << ")" << std::endl;
+}
+
+// Benchmark suites, n is the base problem size
+void	bench_persistent(size_t n);
+void	bench_parallel(size_t n);
+void	bench_simd(size_t n);
+void	bench_deque(size_t n);
+void	bench_priority_queue(size_t n);
+void	bench_setalg(size_t n);
+void	bench_split(size_t n);
+void	bench_node_handle(size_t n);
+void	bench_snapshot(size_t n);
+void	bench_mapped_vector(size_t n);
+void	bench_threaded(size_t n);
+void	bench_parallel_map(size_t n);
+void	bench_tree_stats(size_t n);
+void	bench_find_batch(size_t n);
+void	bench_insert_batch(size_t n);
+void	bench_soa(size_t n);
+void	bench_bitvector(size_t n);
+void	bench_ring(size_t n);
+void	bench_arena(size_t n);
+void	bench_pmr(size_t n);
+void	bench_erase_if(size_t n);
+void	bench_segmented(size_t n);
@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_counters.cpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 17:33:41 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/20 18:37:13 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <stdint.h>
+
+/*
+** Hardware counters for the benchmark harness. Each event is opened on
+** its own, user space only, inherited by the threads the suites spawn,
+** so an event the PMU (or the hypervisor) does not offer drops out alone
+** instead of taking the others with it. bench_now() reads every counter,
+** and bench_report() prints the difference between its last two reads,
+** which bracket the measured region, divided by the number of operations.
+** Counters the kernel had to multiplex are scaled by enabled / running
+** time. Without perf_event_open (containers, seccomp, VMs without a
+** virtual PMU) the harness says so once and reports wall-clock only.
+*/
+
+namespace
+{
+	struct s_event
+	{
+		const char	*name;
+		uint32_t	type;
+		uint64_t	config;
+	};
+
+#define FT_CACHE_EVENT(cache, op, result) \
+	((cache) | (PERF_COUNT_HW_CACHE_OP_ ## op << 8) | (PERF_COUNT_HW_CACHE_RESULT_ ## result << 16))
+
+	const s_event	g_events[] = {
+		{ "cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+		{ "instr", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+		{ "L1d-miss", PERF_TYPE_HW_CACHE, FT_CACHE_EVENT(PERF_COUNT_HW_CACHE_L1D, READ, MISS) },
+		{ "LLC-miss", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+		{ "br-miss", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+		{ "dTLB-miss", PERF_TYPE_HW_CACHE, FT_CACHE_EVENT(PERF_COUNT_HW_CACHE_DTLB, READ, MISS) },
+		{ "faults", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS },
+	};
+
+#undef FT_CACHE_EVENT
+
+	const size_t	g_nevents = sizeof(g_events) / sizeof(g_events[0]);
+
+	bool	g_enabled = false;
+	int		g_fd[g_nevents];
+	double	g_prev[g_nevents];
+	double	g_cur[g_nevents];
+
+	int		open_event(const s_event& event) {
+		perf_event_attr	attr;
+
+		memset(&attr, 0, sizeof(attr));
+		attr.size = sizeof(attr);
+		attr.type = event.type;
+		attr.config = event.config;
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+		attr.inherit = 1;
+		attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+		return syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+	}
+
+		// Count scaled up for the time the event was not scheduled on the PMU
+	double	read_event(int fd) {
+		uint64_t	value[3];
+
+		if (read(fd, value, sizeof(value)) != sizeof(value) || value[2] == 0)
+			return 0;
+		return static_cast<double>(value[0]) * value[1] / value[2];
+	}
+}
+
+bool	bench_counters_open()
+{
+	size_t		opened = 0;
+	size_t		hardware = 0;
+	const char	*reason = NULL;
+
+	for (size_t i = 0; i < g_nevents; i++) {
+		g_fd[i] = open_event(g_events[i]);
+		if (g_fd[i] < 0 && !reason)
+			reason = strerror(errno);
+		opened += g_fd[i] >= 0;
+		hardware += g_fd[i] >= 0 && g_events[i].type != PERF_TYPE_SOFTWARE;
+		g_prev[i] = g_cur[i] = 0;
+	}
+	g_enabled = opened > 0;
+	if (!g_enabled)
+		std::cout << "counters: perf_event_open unavailable (" << reason
+			<< "), reporting wall-clock only" << std::endl;
+	else if (hardware == 0)
+		std::cout << "counters: no hardware counters (" << reason
+			<< "), reporting software events only" << std::endl;
+	return g_enabled;
+}
+
+void	bench_counters_close()
+{
+	for (size_t i = 0; g_enabled && i < g_nevents; i++)
+		if (g_fd[i] >= 0)
+			close(g_fd[i]);
+	g_enabled = false;
+}
+
+void	bench_counters_read()
+{
+	if (!g_enabled)
+		return ;
+	for (size_t i = 0; i < g_nevents; i++) {
+		g_prev[i] = g_cur[i];
+		g_cur[i] = g_fd[i] >= 0 ? read_event(g_fd[i]) : 0;
+	}
+}
+
+	// Per operation counts of the region between the last two reads
+void	bench_counters_report(size_t ops)
+{
+	std::ostringstream	line;
+	double				per[g_nevents];
+
+	if (!g_enabled)
+		return ;
+	for (size_t i = 0; i < g_nevents; i++)
+		per[i] = (g_cur[i] - g_prev[i]) / (ops ? ops : 1);
+	line << std::fixed << std::setprecision(2) << "    ";
+	for (size_t i = 0; i < g_nevents; i++) {
+		if (g_fd[i] < 0)
+			continue ;
+		line << g_events[i].name << " " << per[i] << "  ";
+		if (i == 1 && g_fd[0] >= 0 && per[0] > 0)
+			line << "IPC " << per[1] / per[0] << "  ";
+	}
+	std::cout << line.str() << "(per op)" << std::endl;
+}
@@ -0,0 +1,347 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_gate.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 15:46:35 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/20 17:02:37 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "map.hpp"
+#include "vector.hpp"
+#include <cmath>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <utility>
+
+/*
+** Regression gate. Every bench_report() lands here as a sample of the
+** operation "<suite title> (n = N): <label>", one per repetition. Samples
+** are saved as a baseline JSON file, or compared with one: an operation
+** regresses when its median is more than threshold percent slower and a
+** one-sided Mann-Whitney U test says the slowdown is significant at
+** alpha. The test only looks at ranks, so it shrugs off outliers, but it
+** needs repetitions: with 5 runs on each side the smallest p is 0.004.
+*/
+
+namespace
+{
+	typedef ft::vector<double>					samples;
+	typedef ft::map<std::string, samples>		results;
+
+	results		g_results;
+	std::string	g_title;
+
+	/* ------------------------------------------------------------- */
+	/* ----------------------------- JSON -------------------------- */
+
+	std::string	json_quote(const std::string& s) {
+		std::string	out = "\"";
+
+		for (size_t i = 0; i < s.size(); i++) {
+			if (s[i] == '"' || s[i] == '\\')
+				out += '\\';
+			out += s[i];
+		}
+		return out + "\"";
+	}
+
+		// Just enough JSON for the baseline: objects, arrays, strings,
+		// numbers, true/false/null; values outside "results" are skipped
+	class json_reader
+	{
+		public:
+			explicit json_reader(const std::string& text) : _s(text), _i(0) { }
+
+			bool	read_results(results& out) {
+				_ws();
+				if (!_eat('{'))
+					return false;
+				while (_ws(), !_eat('}')) {
+					std::string	key;
+
+					if (!_string(key) || (_ws(), !_eat(':')))
+						return false;
+					if (key == "results" ? !_results(out) : !_skip())
+						return false;
+					_ws();
+					_eat(',');
+				}
+				return true;
+			}
+
+		private:
+			const std::string&	_s;
+			size_t				_i;
+
+			void	_ws() {
+				while (_i < _s.size() && isspace(static_cast<unsigned char>(_s[_i])))
+					_i++;
+			}
+			bool	_eat(char c) {
+				if (_i < _s.size() && _s[_i] == c) {
+					_i++;
+					return true;
+				}
+				return false;
+			}
+			bool	_string(std::string& out) {
+				if (!_eat('"'))
+					return false;
+				for ( ; _i < _s.size() && _s[_i] != '"'; _i++) {
+					if (_s[_i] == '\\' && ++_i == _s.size())
+						return false;
+					out += _s[_i];
+				}
+				return _eat('"');
+			}
+			bool	_number(double& out) {
+				const char	*begin = _s.c_str() + _i;
+				char		*end;
+
+				out = strtod(begin, &end);
+				_i += end - begin;
+				return end != begin;
+			}
+			bool	_results(results& out) {
+				_ws();
+				if (!_eat('{'))
+					return false;
+				while (_ws(), !_eat('}')) {
+					std::string	key;
+
+					if (!_string(key) || (_ws(), !_eat(':')) || (_ws(), !_eat('[')))
+						return false;
+					samples&	values = out[key];
+
+					while (_ws(), !_eat(']')) {
+						double	x;
+
+						if (!_number(x))
+							return false;
+						values.push_back(x);
+						_ws();
+						_eat(',');
+					}
+					_ws();
+					_eat(',');
+				}
+				return true;
+			}
+			bool	_skip() {
+				std::string	dummy;
+				double		x;
+
+				_ws();
+				if (_i >= _s.size())
+					return false;
+				if (_s[_i] == '"')
+					return _string(dummy);
+				if (_s[_i] == '{' || _s[_i] == '[') {
+					char	close = _s[_i++] == '{' ? '}' : ']';
+
+					while (_ws(), !_eat(close)) {
+						if (close == '}' && (!_string(dummy) || (_ws(), !_eat(':'))))
+							return false;
+						if (!_skip())
+							return false;
+						_ws();
+						_eat(',');
+					}
+					return true;
+				}
+				static const char	*words[] = { "true", "false", "null" };
+
+				for (size_t w = 0; w < 3; w++)
+					if (_s.compare(_i, strlen(words[w]), words[w]) == 0) {
+						_i += strlen(words[w]);
+						return true;
+					}
+				return _number(x);
+			}
+	};
+
+	/* ------------------------------------------------------------- */
+	/* ------------------------- STATISTICS ------------------------ */
+
+	double	median(samples v) {
+		std::sort(v.begin(), v.end());
+		if (v.empty())
+			return 0;
+		return v.size() % 2 ? v[v.size() / 2] : (v[v.size() / 2 - 1] + v[v.size() / 2]) / 2;
+	}
+
+		// P(U >= u) when the samples of sizes m and n come from the same
+		// distribution, counting the orderings of m + n distinct values
+	double	exact_upper_tail(size_t m, size_t n, double u) {
+		size_t						umax = m * n;
+		ft::vector<ft::vector<double> >	prev(n + 1, ft::vector<double>(umax + 1, 0));
+		ft::vector<ft::vector<double> >	cur(prev);
+
+			// counts[j][k]: orderings of i x's and j y's with U = k
+		for (size_t j = 0; j <= n; j++)
+			prev[j][0] = 1;
+		for (size_t i = 1; i <= m; i++) {
+			for (size_t j = 0; j <= n; j++)
+				for (size_t k = 0; k <= umax; k++)
+					cur[j][k] = (j ? cur[j - 1][k] : 0) + (k >= j ? prev[j][k - j] : 0);
+			prev.swap(cur);
+		}
+		double	total = 0;
+		double	tail = 0;
+
+		for (size_t k = 0; k <= umax; k++) {
+			total += prev[n][k];
+			if (k + 1e-9 >= u)
+				tail += prev[n][k];
+		}
+		return tail / total;
+	}
+
+		// One-sided Mann-Whitney U test of "x tends to be larger than y".
+		// Exact without ties for small samples, otherwise the normal
+		// approximation with tie correction and continuity correction.
+	double	mann_whitney_greater(const samples& x, const samples& y) {
+		size_t				m = x.size();
+		size_t				n = y.size();
+		ft::vector<std::pair<double, int> >	all;
+		double				u = 0;
+		double				ties = 0;
+		bool				tied = false;
+
+		if (m == 0 || n == 0)
+			return 1;
+		for (size_t i = 0; i < m; i++)
+			all.push_back(std::make_pair(x[i], 0));
+		for (size_t j = 0; j < n; j++)
+			all.push_back(std::make_pair(y[j], 1));
+		std::sort(all.begin(), all.end());
+		for (size_t i = 0; i < all.size(); ) {
+			size_t	j = i;
+			double	xs = 0;
+
+			while (j < all.size() && all[j].first == all[i].first)
+				j++;
+			for (size_t k = i; k < j; k++)
+				xs += all[k].second == 0;
+			double	t = j - i;
+			double	rank = (i + 1 + j) / 2.0;
+
+			u += xs * rank;
+			if (t > 1) {
+				tied = true;
+				ties += t * t * t - t;
+			}
+			i = j;
+		}
+		u -= m * (m + 1) / 2.0;
+		if (!tied && m <= 20 && n <= 20)
+			return exact_upper_tail(m, n, u);
+		double	N = m + n;
+		double	mean = m * n / 2.0;
+		double	var = m * n / 12.0 * ((N + 1) - ties / (N * (N - 1)));
+
+		if (var <= 0)
+			return 1;
+		return 0.5 * erfc((u - mean - 0.5) / sqrt(var) / sqrt(2.0));
+	}
+}
+
+/* ------------------------------------------------------------- */
+/* ------------------------- INTERFACE ------------------------- */
+
+void	bench_record(const std::string& name, double ns_per_op)
+{
+	g_results[g_title + ": " + name].push_back(ns_per_op);
+}
+
+void	bench_set_title(const std::string& title)
+{
+	g_title = title;
+}
+
+bool	bench_save(const char *path)
+{
+	std::ofstream	os(path);
+
+	os.precision(6);
+
+	os << "{\n  \"format\": \"ft-bench-baseline\",\n  \"version\": 1,\n  \"unit\": \"ns/op\",\n  \"results\": {";
+	for (results::iterator it = g_results.begin(); it != g_results.end(); ++it) {
+		os << (it == g_results.begin() ? "\n" : ",\n") << "    " << json_quote(it->first) << ": [";
+		for (size_t i = 0; i < it->second.size(); i++)
+			os << (i ? ", " : "") << it->second[i];
+		os << "]";
+	}
+	os << "\n  }\n}\n";
+	os.close();
+	if (!os) {
+		std::cerr << "bench: cannot write " << path << std::endl;
+		return false;
+	}
+	std::cout << "\nbaseline: " << g_results.size() << " operations saved to " << path << std::endl;
+	return true;
+}
+
+bool	bench_check(const char *path, double threshold, double alpha)
+{
+	std::ifstream		is(path);
+	std::stringstream	text;
+	results				base;
+	size_t				regressions = 0;
+
+	text << is.rdbuf();
+	if (!is || !json_reader(text.str()).read_results(base)) {
+		std::cerr << "bench: cannot read baseline " << path << std::endl;
+		return false;
+	}
+	std::cout << "\nregression check against " << path << " (threshold " << threshold
+		<< "%, alpha " << alpha << ")\n  " << std::left << std::setw(60) << "operation" << std::right
+		<< std::setw(12) << "base ns" << std::setw(12) << "now ns" << std::setw(10) << "change"
+		<< std::setw(9) << "p" << "  verdict" << std::endl;
+	for (results::iterator it = g_results.begin(); it != g_results.end(); ++it) {
+		results::iterator	b = base.find(it->first);
+		std::string			verdict;
+
+		std::cout << "  " << std::left << std::setw(60) << it->first.substr(0, 59) << std::right << std::fixed;
+		if (b == base.end()) {
+			std::cout << std::setw(12) << "-" << std::setw(12) << std::setprecision(2) << median(it->second)
+				<< std::setw(10) << "-" << std::setw(9) << "-" << "  new" << std::endl;
+			continue ;
+		}
+		double	before = median(b->second);
+		double	after = median(it->second);
+		double	change = before > 0 ? (after - before) * 100.0 / before : 0;
+		double	p_slower = mann_whitney_greater(it->second, b->second);
+		double	p_faster = mann_whitney_greater(b->second, it->second);
+		double	p = change >= 0 ? p_slower : p_faster;
+
+		if (change > threshold && p_slower < alpha) {
+			verdict = "REGRESSED";
+			regressions++;
+		}
+		else if (-change > threshold && p_faster < alpha)
+			verdict = "faster";
+		else
+			verdict = "ok";
+		std::cout << std::setprecision(2) << std::setw(12) << before << std::setw(12) << after
+			<< std::showpos << std::setw(9) << change << "%" << std::noshowpos
+			<< std::setprecision(3) << std::setw(9) << p << "  " << verdict << std::endl;
+	}
+	for (results::iterator b = base.begin(); b != base.end(); ++b)
+		if (g_results.find(b->first) == g_results.end())
+			std::cout << "  " << std::left << std::setw(60) << b->first.substr(0, 59) << std::right
+				<< "  not run" << std::endl;
+	std::cout << (regressions ? "\nFAIL: " : "\nPASS: ") << regressions << " regression"
+		<< (regressions == 1 ? "" : "s") << std::endl;
+	return regressions == 0;
+}
@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_arena.cpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 09:29:45 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/21 12:03:30 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "arena.hpp"
+#include "vector.hpp"
+#include "map.hpp"
+#include <functional>
+#include <sstream>
+
+namespace
+{
+	typedef ft::pair<const size_t, size_t>	entry;
+
+		// A request: a vector of v values and a map of m entries, built
+		// and dropped
+	template <class VectorAlloc, class MapAlloc>
+	size_t	request(size_t v, size_t m, const VectorAlloc& va, const MapAlloc& ma) {
+		ft::vector<size_t, VectorAlloc>								values(va);
+		ft::map<size_t, size_t, std::less<size_t>, MapAlloc>		index(std::less<size_t>(), ma);
+
+		for (size_t i = 0; i < v; i++)
+			values.push_back(bench_rand());
+		for (size_t i = 0; i < m; i++)
+			index.insert(ft::make_pair(values[i % v], i));
+		return values.size() + index.size();
+	}
+
+	std::string	label(const char *name, size_t v, size_t m) {
+		std::ostringstream	os;
+
+		os << name << " " << v << "+" << m;
+		return os.str();
+	}
+}
+
+// n requests, each filling a vector and a map then dropping them, with
+// std::allocator against one ft::arena reset after every request
+void	bench_arena(size_t n) {
+	static const size_t	sizes[][2] = { { 16, 8 }, { 256, 64 }, { 4096, 1024 } };
+	ft::arena			arena;
+	size_t				sum = 0;
+	double				start;
+
+	bench_title("request arena", n);
+	for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+		size_t	v = sizes[s][0];
+		size_t	m = sizes[s][1];
+		size_t	count = n * 16 / v;
+
+		start = bench_now();
+		for (size_t i = 0; i < count; i++)
+			sum += request(v, m, std::allocator<size_t>(), std::allocator<entry>());
+		bench_report(label("std::allocator", v, m), bench_now() - start, count);
+		start = bench_now();
+		for (size_t i = 0; i < count; i++) {
+			sum += request(v, m, ft::arena_allocator<size_t>(arena), ft::arena_allocator<entry>(arena));
+			arena.reset();
+		}
+		bench_report(label("ft::arena", v, m), bench_now() - start, count);
+	}
+	std::cout << "  arena: " << arena.reserved() / 1024 << " KB reserved" << std::endl;
+	bench_keep(sum);
+}
@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_bitvector.cpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 04:19:28 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/21 06:34:30 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "vector.hpp"
+
+namespace
+{
+	typedef ft::vector<bool>			bits;
+	typedef ft::vector<unsigned char>	bytes;
+}
+
+// n flags, one in 64 set, as packed bits against a byte per flag (the
+// layout ft::vector<bool> had before): push_back, random reads, count,
+// visiting the set flags and and-ing two sets
+void	bench_bitvector(size_t n) {
+	bits	a, b;
+	bytes	x, y;
+	double	start;
+	size_t	sum;
+
+	bench_title("packed vector<bool>", n);
+	start = bench_now();
+	for (size_t i = 0; i < n; i++)
+		x.push_back(bench_rand() % 64 == 0);
+	bench_report("bytes push_back", bench_now() - start, n);
+	start = bench_now();
+	for (size_t i = 0; i < n; i++)
+		a.push_back(x[i]);
+	bench_report("bits push_back", bench_now() - start, n);
+	for (size_t i = 0; i < n; i++) {
+		y.push_back(bench_rand() % 2);
+		b.push_back(y[i]);
+	}
+	std::cout << "  memory: " << x.capacity() / 1024 << " KB of bytes, "
+		<< a.capacity() / 8 / 1024 << " KB of bits" << std::endl;
+
+	sum = 0;
+	start = bench_now();
+	for (size_t i = 0; i < n; i++)
+		sum += x[bench_rand() % n];
+	bench_report("bytes random read", bench_now() - start, n);
+	start = bench_now();
+	for (size_t i = 0; i < n; i++)
+		sum -= a[bench_rand() % n];
+	bench_report("bits random read", bench_now() - start, n);
+	bench_keep(sum);
+
+	start = bench_now();
+	for (size_t i = 0; i < n; i++)
+		sum += x[i];
+	bench_report("bytes count", bench_now() - start, n);
+	start = bench_now();
+	sum -= a.count();
+	bench_report("bits count", bench_now() - start, n);
+	bench_keep(sum);
+
+	start = bench_now();
+	for (size_t i = 0; i < n; i++)
+		if (x[i])
+			sum += i;
+	bench_report("bytes visit set", bench_now() - start, n);
+	start = bench_now();
+	for (size_t i = a.find_first(); i < n; i = a.find_next(i))
+		sum -= i;
+	bench_report("bits find_next", bench_now() - start, n);
+	bench_keep(sum);
+
+	start = bench_now();
+	for (size_t i = 0; i < n; i++)
+		x[i] &= y[i];
+	bench_report("bytes and", bench_now() - start, n);
+	start = bench_now();
+	a &= b;
+	bench_report("bits &=", bench_now() - start, n);
+	bench_keep(a.count() + x[n / 2]);
+}
@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_deque.cpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 20:26:34 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/19 20:26:34 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "bench.hpp"
+#include "deque.hpp"
+#include "vector.hpp"
+#include <deque>
+#include <sstream>
+
+namespace
+{
+	std::string	label(const char *container, const char *op, size_t depth) {
+		std::ostringstream	os;
+
+		os << container << " " << op;
+		if (depth)
+			os << " depth " << depth;
+		return os.str();
+	}
+
+		// FIFO at a steady depth: one push_back and one pop_front per operation
+	template <class Queue>
+	void	queue(const char *name, size_t n, size_t depth) {
+		Queue	q;
+		double	start;
+
+		for (size_t i = 0; i < depth; i++)
+			q.push_back(i);
+		start = bench_now();
+		for (size_t i = 0; i < n; i++) {
+			q.push_back(i);
+			bench_keep(q.front());
+			q.pop_front();
+		}
+		bench_report(label(name, "push_back/pop_front", depth), bench_now() - start, n);
+	}
+
+		// ft::vector has no pop_front, erase(begin()) moves the whole queue
+	void	vector_queue(size_t n, size_t depth) {
+		ft::vector<size_t>	q;
+		double				start;
+
+		for (size_t i = 0; i < depth; i++)
+			q.push_back(i);
+		start = bench_now();
+		for (size_t i = 0; i < n; i++) {
+			q.push_back(i);
+			bench_keep(q.front());
+			q.erase(q.begin());
+		}
+		bench_report(label("ft::vector", "push_back/erase(begin)", depth), bench_now() - start, n);
+	}
+
+	template <class Seq>
+	void	access(const char *name, size_t n) {
+		Seq		c;
+		size_t	sum = 0;
+		double	start;
+
+		start = bench_now();
+		for (size_t i = 0; i < n; i++)
+			c.push_back(i);
+		bench_report(label(name, "push_back", 0), bench_now() - start, n);
+		start = bench_now();
+		for (typename Seq::const_iterator it = c.begin(); it != c.end(); ++it)
+			sum += *it;
+		bench_keep(sum);
+		bench_report(label(name, "iterate", 0), bench_now() - start, n);
+		start = bench_now();
+		for (size_t i = 0; i < n; i++)
+			sum += c[bench_rand() % n];
+		bench_keep(sum);
+		bench_report(label(name, "random operator[]", 0), bench_now() - start, n);
+		start = bench_now();
+		for (typename Seq::const_iterator it = c.begin(); c.end() - it > 7; it += 7)
+			sum += *it;
+		bench_keep(sum);
+		bench_report(label(name, "iterator += 7", 0), bench_now() - start, n / 7);
+	}
+}
+
+// ft::deque against std::deque and ft::vector as a FIFO queue
+// and as a random-access sequence
+void	bench_deque(size_t n) {
+	bench_title("deque", n);
+	for (size_t depth = 16; depth <= 16384; depth *= 32) {
+		queue<ft::deque<size_t> >("ft::deque", n, depth);
+		queue<std::deque<size_t> >("std::deque", n, depth);
+		vector_queue(depth > 1024 ? n / 64 : n / 8, depth);
+	}
+	access<ft::deque<size_t> >("ft::deque", n);
+	access<std::deque<size_t> >("std::deque", n);
+	access<ft::vector<size_t> >("ft::vector", n);
+}
@@ -0,0 +1,79 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_erase_if.cpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 15:44:16 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/21 16:10:25 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "vector.hpp"
+#include <sstream>
+
+namespace
+{
+	typedef ft::vector<size_t>	vector;
+
+		// Values are percentiles: v % 100 < percent picks that share
+	struct below
+	{
+		size_t	percent;
+
+		explicit below(size_t p) : percent(p) { }
+		bool	operator()(size_t v) const { return v % 100 < percent; }
+	};
+
+	std::string	label(const char *op, size_t percent, size_t n) {
+		std::ostringstream	os;
+
+		os << op << " " << percent << "% of " << n;
+		return os.str();
+	}
+
+	void	fill(vector& v, size_t n) {
+		v.clear();
+		for (size_t i = 0; i < n; i++)
+			v.push_back(bench_rand());
+	}
+}
+
+// Removing 1% to 90% of an ft::vector of n values: erase_if and
+// erase_indices in one pass against one erase(position) per element,
+// which is O(n k) and runs on n / 100 values only (ns/op is per element
+// of the vector in every case)
+void	bench_erase_if(size_t n) {
+	static const size_t	percents[] = { 1, 10, 50, 90 };
+	size_t				small = n / 100;
+	vector				v;
+	ft::vector<size_t>	indices;
+	double				start;
+
+	bench_title("erase_if compaction", n);
+	for (size_t p = 0; p < sizeof(percents) / sizeof(percents[0]); p++) {
+		below	pred(percents[p]);
+
+		fill(v, small);
+		start = bench_now();
+		for (vector::iterator it = v.begin(); it != v.end(); )
+			it = pred(*it) ? v.erase(it) : it + 1;
+		bench_report(label("erase loop", percents[p], small), bench_now() - start, small);
+
+		fill(v, n);
+		start = bench_now();
+		bench_keep(ft::erase_if(v, pred));
+		bench_report(label("erase_if", percents[p], n), bench_now() - start, n);
+
+		fill(v, n);
+		indices.clear();
+		for (size_t i = 0; i < n; i++)
+			if (pred(v[i]))
+				indices.push_back(i);
+		start = bench_now();
+		bench_keep(ft::erase_indices(v, indices.begin(), indices.end()));
+		bench_report(label("erase_indices", percents[p], n), bench_now() - start, n);
+	}
+}
@@ -0,0 +1,79 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_find_batch.cpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 21:55:19 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/20 21:55:19 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "map.hpp"
+#include <sstream>
+
+namespace
+{
+	typedef ft::map<size_t, size_t>	map;
+
+	std::string	label(const char *op, size_t batch) {
+		std::ostringstream	os;
+
+		os << op;
+		if (batch)
+			os << ", batches of " << batch;
+		return os.str();
+	}
+}
+
+// Lookups of random keys, half of them present, in a map of n entries
+// (far larger than the caches by default): one find at a time against
+// find_batch and count_batch called on batches of 8 to 256 keys
+void	bench_find_batch(size_t n) {
+	map							m;
+	ft::vector<size_t>			keys;
+	ft::vector<size_t>			queries;
+	ft::vector<map::iterator>	found(256);
+	size_t						q = n < 1000000 ? n : 1000000;
+	size_t						sum = 0;
+	double						start;
+
+	bench_title("batched map lookups", n);
+	for (size_t i = 0; i < n; i++) {
+		keys.push_back(bench_rand());
+		m.insert(ft::make_pair(keys.back(), i));
+	}
+	for (size_t i = 0; i < q; i++)
+		queries.push_back(i % 2 ? keys[bench_rand() % n] : bench_rand());
+	start = bench_now();
+	for (size_t i = 0; i < q; i++) {
+		map::iterator	it = m.find(queries[i]);
+
+		sum += it == m.end() ? 0 : it->second;
+	}
+	bench_report(label("find", 0), bench_now() - start, q);
+	for (size_t batch = 8; batch <= 256; batch *= 2) {
+		start = bench_now();
+		for (size_t i = 0; i < q; i += batch) {
+			size_t	end = i + batch < q ? i + batch : q;
+
+			m.find_batch(queries.begin() + i, queries.begin() + end, found.begin());
+			for (size_t j = 0; j < end - i; j++)
+				sum += found[j] == m.end() ? 0 : found[j]->second;
+		}
+		bench_report(label("find_batch", batch), bench_now() - start, q);
+	}
+	start = bench_now();
+	for (size_t i = 0; i < q; i++)
+		sum += m.count(queries[i]);
+	bench_report(label("count", 0), bench_now() - start, q);
+	for (size_t batch = 8; batch <= 256; batch *= 4) {
+		start = bench_now();
+		for (size_t i = 0; i < q; i += batch)
+			sum += m.count_batch(queries.begin() + i, queries.begin() + (i + batch < q ? i + batch : q));
+		bench_report(label("count_batch", batch), bench_now() - start, q);
+	}
+	bench_keep(sum);
+}
@@ -0,0 +1,68 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_insert_batch.cpp                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 23:33:06 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/20 23:33:06 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "map.hpp"
+#include <sstream>
+
+namespace
+{
+	typedef ft::map<size_t, size_t>		map;
+	typedef ft::pair<size_t, size_t>	entry;
+
+	std::string	label(const char *op, double ratio) {
+		std::ostringstream	os;
+
+		os << op << ", batch/map " << ratio;
+		return os.str();
+	}
+}
+
+// Inserting a batch of unsorted keys, one in ten already present, into a
+// map of n entries: the insert loop against insert_batch, for batches of
+// 0.001 to 10 times the size of the map
+void	bench_insert_batch(size_t n) {
+	static const double	ratios[] = { 0.001, 0.01, 0.1, 1, 10 };
+	map					base;
+	ft::vector<size_t>	keys;
+
+	bench_title("batched map inserts", n);
+	for (size_t i = 0; i < n; i++) {
+		keys.push_back(bench_rand());
+		base.insert(entry(keys.back(), i));
+	}
+	for (size_t r = 0; r < sizeof(ratios) / sizeof(ratios[0]); r++) {
+		size_t				m = static_cast<size_t>(n * ratios[r]);
+		ft::vector<entry>	batch;
+		size_t				added = 0;
+		double				start;
+
+		for (size_t i = 0; i < m; i++)
+			batch.push_back(entry(i % 10 ? bench_rand() : keys[bench_rand() % n], i));
+		{
+			map	a(base);
+
+			start = bench_now();
+			for (size_t i = 0; i < m; i++)
+				added += a.insert(batch[i]).second;
+			bench_report(label("insert loop", ratios[r]), bench_now() - start, m);
+		}
+		{
+			map	b(base);
+
+			start = bench_now();
+			added -= b.insert_batch(batch.begin(), batch.end());
+			bench_report(label("insert_batch", ratios[r]), bench_now() - start, m);
+		}
+		bench_keep(added);
+	}
+}
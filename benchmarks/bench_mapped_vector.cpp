@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_mapped_vector.cpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 09:12:33 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/20 09:12:33 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "bench.hpp"
+#include "mapped_vector.hpp"
+#include "vector.hpp"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+	const char	*g_mapped = "/tmp/ft_bench_mapped.bin";
+	const char	*g_plain = "/tmp/ft_bench_plain.bin";
+
+	std::string	label(const char *op, size_t n) {
+		std::ostringstream	os;
+
+		os << op << " " << n;
+		return os.str();
+	}
+
+	size_t	sum(const size_t *p, size_t n) {
+		size_t	s = 0;
+
+		for (size_t i = 0; i < n; i++)
+			s += p[i];
+		return s;
+	}
+
+		// Appends n elements and makes them durable, then reopens them
+	void	mapped(size_t n) {
+		double	start;
+
+		remove(g_mapped);
+		{
+			ft::mapped_vector<size_t>	v(g_mapped);
+
+			start = bench_now();
+			for (size_t i = 0; i < n; i++)
+				v.push_back(i);
+			bench_report(label("mapped_vector push_back", n), bench_now() - start, n);
+			start = bench_now();
+			v.sync();
+			bench_report(label("mapped_vector sync", n), bench_now() - start, n);
+		}
+		start = bench_now();
+		{
+			ft::mapped_vector<size_t>	v(g_mapped);
+
+			bench_keep(v.back());
+			bench_report(label("mapped_vector open", n), bench_now() - start, 1);
+			start = bench_now();
+			bench_keep(sum(v.data(), v.size()));
+			bench_report(label("mapped_vector scan after open", n), bench_now() - start, n);
+		}
+	}
+
+		// Same data kept in an ft::vector and written out on shutdown
+	void	plain(size_t n) {
+		double	start;
+
+		{
+			ft::vector<size_t>	v;
+
+			start = bench_now();
+			for (size_t i = 0; i < n; i++)
+				v.push_back(i);
+			bench_report(label("vector push_back", n), bench_now() - start, n);
+			start = bench_now();
+			std::ofstream	os(g_plain, std::ios::binary);
+			os.write(reinterpret_cast<const char *>(v.data()), v.size() * sizeof(size_t));
+			os.flush();
+			bench_report(label("vector write on shutdown", n), bench_now() - start, n);
+		}
+		start = bench_now();
+		{
+			std::ifstream		is(g_plain, std::ios::binary);
+			ft::vector<size_t>	v;
+
+			is.seekg(0, std::ios::end);
+			v.resize(is.tellg() / sizeof(size_t));
+			is.seekg(0);
+			is.read(reinterpret_cast<char *>(v.data()), v.size() * sizeof(size_t));
+			bench_report(label("vector read on open", n), bench_now() - start, 1);
+			start = bench_now();
+			bench_keep(sum(v.data(), v.size()));
+			bench_report(label("vector scan after open", n), bench_now() - start, n);
+		}
+	}
+}
+
+// ft::mapped_vector against an ft::vector written to a file on shutdown:
+// append throughput, the cost of a durability point, and reopening.
+// Open times are per open, through the page cache.
+void	bench_mapped_vector(size_t n) {
+	bench_title("mapped_vector", n);
+	mapped(n);
+	plain(n);
+	remove(g_mapped);
+	remove(g_plain);
+}
@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_node_handle.cpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 04:15:25 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/20 04:15:25 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "bench.hpp"
+#include "map.hpp"
+#include "vector.hpp"
+#include <sstream>
+
+namespace
+{
+	typedef ft::map<size_t, ft::vector<char> >	map_type;
+
+	std::string	label(const char *op, size_t n, size_t bytes) {
+		std::ostringstream	os;
+
+		os << op << " " << n << " x " << bytes << "B";
+		return os.str();
+	}
+
+	void	fill(map_type& map, size_t n, size_t bytes) {
+		for (size_t i = 0; i < n; i++)
+			map.insert(ft::make_pair(i * 2, ft::vector<char>(bytes, 'x')));
+	}
+
+		// Every key k becomes k + 1, by copy then erase or by node handle
+	void	rekey(size_t n, size_t bytes) {
+		map_type	a;
+		map_type	b;
+		double		start;
+
+		fill(a, n, bytes);
+		fill(b, n, bytes);
+		start = bench_now();
+		for (size_t i = 0; i < n; i++) {
+			map_type::iterator	it = a.find(i * 2);
+
+			a.insert(ft::make_pair(i * 2 + 1, it->second));
+			a.erase(it);
+		}
+		bench_report(label("re-key, insert + erase", n, bytes), bench_now() - start, n);
+		start = bench_now();
+		for (size_t i = 0; i < n; i++) {
+			map_type::node_type	nh = b.extract(i * 2);
+
+			nh.key() = i * 2 + 1;
+			b.insert(std::move(nh));
+		}
+		bench_report(label("re-key, extract + insert", n, bytes), bench_now() - start, n);
+	}
+
+		// Moves a whole map into another one holding the odd keys
+	void	migrate(size_t n, size_t bytes) {
+		map_type	a, b, c, d;
+		double		start;
+
+		fill(a, n, bytes);
+		fill(c, n, bytes);
+		for (size_t i = 0; i < n; i++) {
+			b.insert(ft::make_pair(i * 2 + 1, ft::vector<char>()));
+			d.insert(ft::make_pair(i * 2 + 1, ft::vector<char>()));
+		}
+		start = bench_now();
+		for (map_type::iterator it = a.begin(); it != a.end(); )
+		{
+			b.insert(*it);
+			a.erase(it++);
+		}
+		bench_report(label("migrate, insert + erase", n, bytes), bench_now() - start, n);
+		start = bench_now();
+		d.merge(c);
+		bench_report(label("migrate, merge", n, bytes), bench_now() - start, n);
+	}
+}
+
+// Moving ft::map entries by node handle against copying them
+void	bench_node_handle(size_t n) {
+	bench_title("map node handles", n);
+	for (size_t bytes = 16; bytes <= 4096; bytes *= 16) {
+		rekey(n, bytes);
+		migrate(n, bytes);
+	}
+}
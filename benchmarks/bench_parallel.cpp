@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_parallel.cpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:59:53 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/19 13:59:53 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "parallel_algorithm.hpp"
+#include <sstream>
+
+namespace
+{
+	struct scale { void operator()(double& x) const { x = x * 1.000001 + 0.5; } };
+	struct square { double operator()(double x) const { return x * x; } };
+	struct above { double limit; bool operator()(double x) const { return x > limit; } };
+
+	std::string	label(const char *op, size_t threads) {
+		std::ostringstream	os;
+
+		os << op << " x" << threads;
+		return os.str();
+	}
+}
+
+// Scaling of the parallel algorithms over ft::vector<double> across thread counts,
+// for sizes from 10^6 up to n
+void	bench_parallel(size_t n) {
+	size_t	hw = ft::thread_pool::hardware_concurrency();
+
+	for (size_t size = 1000000; size <= n; size *= 10) {
+		ft::vector<double>	v(size, 1.0);
+		ft::vector<double>	out(size);
+
+		bench_title("parallel algorithms", size);
+		for (size_t threads = 1; ; threads = threads * 2 > hw && threads < hw ? hw : threads * 2) {
+			ft::thread_pool	pool(threads);
+			double			start;
+
+			start = bench_now();
+			ft::for_each(pool, v.begin(), v.end(), scale());
+			bench_report(label("for_each", threads), bench_now() - start, size);
+			start = bench_now();
+			ft::transform(pool, v.begin(), v.end(), out.begin(), square());
+			bench_report(label("transform", threads), bench_now() - start, size);
+			start = bench_now();
+			bench_keep(ft::reduce(pool, out.begin(), out.end(), 0.0));
+			bench_report(label("reduce", threads), bench_now() - start, size);
+			start = bench_now();
+			ft::inclusive_scan(pool, v.begin(), v.end(), out.begin());
+			bench_report(label("inclusive_scan", threads), bench_now() - start, size);
+			above	half = { out[size / 2] };
+			start = bench_now();
+			bench_keep(ft::count_if(pool, out.begin(), out.end(), half));
+			bench_report(label("count_if", threads), bench_now() - start, size);
+			above	last = { out[size - 2] };
+			start = bench_now();
+			bench_keep(ft::find_if(pool, out.begin(), out.end(), last));
+			bench_report(label("find_if (match at the end)", threads), bench_now() - start, size);
+			if (threads >= hw)
+				break;
+		}
+	}
+}
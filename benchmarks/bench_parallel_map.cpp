@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_parallel_map.cpp                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 13:28:59 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/20 13:28:59 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "bench.hpp"
+#include "map.hpp"
+#include "parallel_algorithm.hpp"
+#include <sstream>
+
+namespace
+{
+	typedef ft::map<size_t, size_t>	map_type;
+
+	struct second_of { size_t operator()(const map_type::value_type& x) const { return x.second; } };
+	struct plus { size_t operator()(size_t a, size_t b) const { return a + b; } };
+
+	std::string	label(const char *op, size_t threads) {
+		std::ostringstream	os;
+
+		os << op << " x" << threads;
+		return os.str();
+	}
+}
+
+// Parallel reduce over an ft::map of n random keys cut with partition(),
+// across thread counts, against one sequential pass
+void	bench_parallel_map(size_t n) {
+	size_t		hw = ft::thread_pool::hardware_concurrency();
+	map_type	m;
+	size_t		sum = 0;
+	double		start;
+
+	for (size_t i = 0; i < n; i++)
+		m.insert(ft::make_pair(bench_rand(), i));
+	bench_title("parallel map traversal", m.size());
+	start = bench_now();
+	for (map_type::const_iterator it = m.begin(); it != m.end(); ++it)
+		sum += it->second;
+	bench_report("sequential sum", bench_now() - start, m.size());
+	bench_keep(sum);
+	for (size_t threads = 1; ; threads = threads * 2 > hw && threads < hw ? hw : threads * 2) {
+		ft::thread_pool		pool(threads);
+		size_t				k = threads * ft::thread_pool::chunks_per_thread;
+
+		start = bench_now();
+		ft::vector<map_type::iterator>		bounds = m.partition(k);
+		bench_report(label("partition", threads), bench_now() - start, 1);
+		start = bench_now();
+		bench_keep(ft::transform_reduce(pool, bounds, size_t(0), plus(), second_of()));
+		bench_report(label("transform_reduce", threads), bench_now() - start, m.size());
+		if (threads >= hw)
+			break;
+	}
+}
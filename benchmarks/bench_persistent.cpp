@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_persistent.cpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:01:47 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/19 13:01:47 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "map.hpp"
+#include "persistent_map.hpp"
+
+// Snapshot cost and update overhead of ft::persistent_map against copying ft::map
+void	bench_persistent(size_t n) {
+	ft::map<int, int>				map;
+	ft::persistent_map<int, int>	pmap;
+	size_t							snaps = 16;
+	double							start;
+
+	bench_title("persistent_map", n);
+	start = bench_now();
+	for (size_t i = 0; i < n; i++)
+		map.insert(ft::make_pair(static_cast<int>(bench_rand() % (n * 4)), static_cast<int>(i)));
+	bench_report("ft::map insert", bench_now() - start, n);
+	start = bench_now();
+	for (ft::map<int, int>::iterator it = map.begin(); it != map.end(); it++)
+		pmap.insert(*it);
+	bench_report("ft::persistent_map insert (no snapshot)", bench_now() - start, map.size());
+
+	start = bench_now();
+	for (size_t i = 0; i < snaps; i++) {
+		ft::map<int, int>	copy(map);
+		bench_keep(copy.size());
+	}
+	bench_report("ft::map copy as snapshot", bench_now() - start, snaps);
+	start = bench_now();
+	for (size_t i = 0; i < snaps * 1000; i++) {
+		ft::persistent_map<int, int>	snap = pmap.snapshot();
+		bench_keep(snap.size());
+	}
+	bench_report("ft::persistent_map snapshot", bench_now() - start, snaps * 1000);
+
+	start = bench_now();
+	for (size_t i = 0; i < n; i++)
+		map[static_cast<int>(bench_rand() % (n * 4))] = static_cast<int>(i);
+	bench_report("ft::map update", bench_now() - start, n);
+	start = bench_now();
+	for (size_t i = 0; i < n; i++)
+		pmap.insert_or_assign(static_cast<int>(bench_rand() % (n * 4)), static_cast<int>(i));
+	bench_report("ft::persistent_map update (no snapshot)", bench_now() - start, n);
+	start = bench_now();
+	{
+		ft::persistent_map<int, int>	snap;
+		for (size_t i = 0; i < n; i++) {
+			if (i % 64 == 0)
+				snap = pmap.snapshot();
+			pmap.insert_or_assign(static_cast<int>(bench_rand() % (n * 4)), static_cast<int>(i));
+		}
+	}
+	bench_report("ft::persistent_map update (snapshot / 64 updates)", bench_now() - start, n);
+	start = bench_now();
+	for (size_t i = 0; i < n; i++) {
+		ft::persistent_map<int, int>	snap = pmap.snapshot();
+		pmap.insert_or_assign(static_cast<int>(bench_rand() % (n * 4)), static_cast<int>(i));
+	}
+	bench_report("ft::persistent_map update (snapshot / update)", bench_now() - start, n);
+}
@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_pmr.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 13:59:17 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/21 14:29:45 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "memory_resource.hpp"
+#include <sstream>
+
+namespace
+{
+	typedef ft::pair<const size_t, size_t>	entry;
+
+		// n inserts into a map of keys below n / 2, then erasing every
+		// key, the node churn of a cache
+	template <class Map>
+	size_t	churn(Map& m, size_t n) {
+		size_t	hits = 0;
+
+		for (size_t i = 0; i < n; i++)
+			hits += !m.insert(ft::make_pair(bench_rand() % (n / 2 + 1), i)).second;
+		for (size_t i = 0; i <= n / 2; i++)
+			m.erase(i);
+		return hits;
+	}
+
+		// 64 allocate/deallocate pairs of 48 bytes (a map node), n times
+	template <class Alloc>
+	void	pairs(const std::string& name, Alloc alloc, size_t n) {
+		typename Alloc::pointer	p[64];
+		double					start = bench_now();
+
+		for (size_t i = 0; i < n / 64; i++) {
+			for (size_t k = 0; k < 64; k++)
+				p[k] = alloc.allocate(1);
+			for (size_t k = 0; k < 64; k++)
+				alloc.deallocate(p[k], 1);
+		}
+		bench_report(name, bench_now() - start, n / 64 * 64);
+	}
+
+	struct node { char bytes[48]; };
+}
+
+// The cost of choosing the allocator at runtime: the same work through
+// static allocators and through ft::pmr::polymorphic_allocator over each
+// memory resource
+void	bench_pmr(size_t n) {
+	ft::pmr::unsynchronized_pool_resource	pool;
+	ft::pmr::synchronized_pool_resource		shared_pool;
+	ft::pmr::monotonic_buffer_resource		buffer;
+	ft::arena								arena;
+	double									start;
+	size_t									sum = 0;
+
+	bench_title("polymorphic allocators", n);
+	pairs("std::allocator alloc/free", std::allocator<node>(), n);
+	pairs("pmr new_delete alloc/free", ft::pmr::polymorphic_allocator<node>(ft::pmr::new_delete_resource()), n);
+	pairs("pmr unsync pool alloc/free", ft::pmr::polymorphic_allocator<node>(&pool), n);
+	pairs("pmr sync pool alloc/free", ft::pmr::polymorphic_allocator<node>(&shared_pool), n);
+	pairs("ft::arena_allocator alloc", ft::arena_allocator<node>(arena), n);
+	pairs("pmr monotonic alloc", ft::pmr::polymorphic_allocator<node>(&buffer), n);
+	arena.release();
+	buffer.release();
+
+	{
+		ft::vector<size_t>	v;
+
+		start = bench_now();
+		for (size_t i = 0; i < n; i++)
+			v.push_back(i);
+		bench_report("std::allocator vector push_back", bench_now() - start, n);
+	}
+	{
+		ft::pmr::vector<size_t>	v(ft::pmr::new_delete_resource());
+
+		start = bench_now();
+		for (size_t i = 0; i < n; i++)
+			v.push_back(i);
+		bench_report("pmr new_delete vector push_back", bench_now() - start, n);
+	}
+	{
+		ft::map<size_t, size_t>	m;
+
+		start = bench_now();
+		sum += churn(m, n);
+		bench_report("std::allocator map churn", bench_now() - start, n);
+	}
+	{
+		std::less<size_t>						less;
+		ft::pmr::map<size_t, size_t>			m(less, ft::pmr::new_delete_resource());
+
+		start = bench_now();
+		sum += churn(m, n);
+		bench_report("pmr new_delete map churn", bench_now() - start, n);
+	}
+	{
+		std::less<size_t>						less;
+		ft::pmr::map<size_t, size_t>			m(less, &pool);
+
+		start = bench_now();
+		sum += churn(m, n);
+		bench_report("pmr unsync pool map churn", bench_now() - start, n);
+	}
+	{
+		std::less<size_t>						less;
+		ft::pmr::map<size_t, size_t>			m(less, &shared_pool);
+
+		start = bench_now();
+		sum += churn(m, n);
+		bench_report("pmr sync pool map churn", bench_now() - start, n);
+	}
+	bench_keep(sum);
+}
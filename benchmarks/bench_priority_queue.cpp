@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_priority_queue.cpp                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 22:46:50 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/19 22:46:50 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "bench.hpp"
+#include "priority_queue.hpp"
+#include <queue>
+#include <vector>
+#include <sstream>
+
+namespace
+{
+	typedef std::pair<size_t, size_t>	std_entry;
+
+	std::string	label(const char *queue, const char *op, size_t size) {
+		std::ostringstream	os;
+
+		os << queue << " " << op << " " << size;
+		return os.str();
+	}
+
+		// m pushes of random keys then m pops, reps times
+	template <class Queue>
+	void	push_pop(const char *name, size_t m, size_t reps) {
+		double	start = bench_now();
+
+		for (size_t r = 0; r < reps; r++) {
+			Queue	q;
+
+			for (size_t i = 0; i < m; i++)
+				q.push(bench_rand());
+			for (size_t i = 0; i < m; i++) {
+				bench_keep(q.top());
+				q.pop();
+			}
+		}
+		bench_report(label(name, "push+pop", m), bench_now() - start, 2 * m * reps);
+	}
+
+		// Heap construction from an unordered range
+	template <class Queue>
+	void	build(const char *name, const std::vector<size_t>& keys, size_t reps) {
+		double	start = bench_now();
+
+		for (size_t r = 0; r < reps; r++) {
+			Queue	q(keys.begin(), keys.end());
+
+			bench_keep(q.top());
+		}
+		bench_report(label(name, "build", keys.size()), bench_now() - start, keys.size() * reps);
+	}
+
+		// Dijkstra-like min-queue: m keys, m key decreases, then drain.
+		// std::priority_queue has no decrease-key, so it pushes a new
+		// entry and skips the stale ones when they reach the top.
+	void	decrease_ft(size_t m, size_t reps) {
+		double	start = bench_now();
+
+		for (size_t r = 0; r < reps; r++) {
+			ft::indexed_priority_queue<size_t, std::greater<size_t> >	q(m);
+
+			for (size_t id = 0; id < m; id++)
+				q.push(id, bench_rand() % (m * 16) + m * 16);
+			for (size_t i = 0; i < m; i++) {
+				size_t	id = bench_rand() % m;
+
+				if (q.key(id) > 0)
+					q.update(id, q.key(id) - bench_rand() % (q.key(id) / 2 + 1));
+			}
+			while (!q.empty()) {
+				bench_keep(q.top_id());
+				q.pop();
+			}
+		}
+		bench_report(label("ft::indexed_priority_queue", "decrease-key", m), bench_now() - start, 3 * m * reps);
+	}
+
+	void	decrease_std(size_t m, size_t reps) {
+		double	start = bench_now();
+
+		for (size_t r = 0; r < reps; r++) {
+			std::priority_queue<std_entry, std::vector<std_entry>, std::greater<std_entry> >	q;
+			std::vector<size_t>	key(m);
+			std::vector<bool>	done(m, false);
+
+			for (size_t id = 0; id < m; id++) {
+				key[id] = bench_rand() % (m * 16) + m * 16;
+				q.push(std_entry(key[id], id));
+			}
+			for (size_t i = 0; i < m; i++) {
+				size_t	id = bench_rand() % m;
+
+				key[id] -= bench_rand() % (key[id] / 2 + 1);
+				q.push(std_entry(key[id], id));
+			}
+			while (!q.empty()) {
+				std_entry	e = q.top();
+
+				q.pop();
+				if (done[e.second] || e.first != key[e.second])
+					continue ;
+				done[e.second] = true;
+				bench_keep(e.second);
+			}
+		}
+		bench_report(label("std::priority_queue", "lazy decrease-key", m), bench_now() - start, 3 * m * reps);
+	}
+}
+
+// 4-ary ft::priority_queue against the binary std::priority_queue,
+// heap sizes from 10^3 to n with the total work kept around n per size
+void	bench_priority_queue(size_t n) {
+	typedef ft::priority_queue<size_t>		ft_queue;
+	typedef std::priority_queue<size_t>		std_queue;
+
+	bench_title("priority_queue", n);
+	for (size_t m = 1000; m <= n; m *= 10) {
+		size_t				reps = n / m;
+		std::vector<size_t>	keys(m);
+
+		for (size_t i = 0; i < m; i++)
+			keys[i] = bench_rand();
+		push_pop<ft_queue>("ft::priority_queue", m, reps);
+		push_pop<std_queue>("std::priority_queue", m, reps);
+		build<ft_queue>("ft::priority_queue", keys, reps);
+		build<std_queue>("std::priority_queue", keys, reps);
+		decrease_ft(m, reps);
+		decrease_std(m, reps);
+	}
+}
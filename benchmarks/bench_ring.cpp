@@ -0,0 +1,217 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_ring.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 07:54:06 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/21 08:10:51 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "ring.hpp"
+#include "vector.hpp"
+#include "thread_pool.hpp"
+#include <pthread.h>
+#include <sstream>
+
+namespace
+{
+	static const size_t	capacity = 1024;
+
+		// What the rings replace: an ft::vector used as a ring under a mutex
+	class locked_ring
+	{
+		public:
+			explicit locked_ring(size_t cap) : _buf(cap), _head(0), _size(0) {
+				pthread_mutex_init(&_lock, NULL);
+				pthread_cond_init(&_not_empty, NULL);
+				pthread_cond_init(&_not_full, NULL);
+			}
+			~locked_ring() {
+				pthread_cond_destroy(&_not_full);
+				pthread_cond_destroy(&_not_empty);
+				pthread_mutex_destroy(&_lock);
+			}
+
+			void	push_n(const size_t* first, size_t n) {
+				pthread_mutex_lock(&_lock);
+				while (n != 0) {
+					while (_size == _buf.size())
+						pthread_cond_wait(&_not_full, &_lock);
+					for ( ; n != 0 && _size < _buf.size(); n--, _size++)
+						_buf[(_head + _size) % _buf.size()] = *first++;
+					pthread_cond_broadcast(&_not_empty);
+				}
+				pthread_mutex_unlock(&_lock);
+			}
+			size_t	pop_n(size_t* out, size_t max) {
+				size_t	n = 0;
+
+				pthread_mutex_lock(&_lock);
+				while (_size == 0)
+					pthread_cond_wait(&_not_empty, &_lock);
+				for ( ; n < max && _size != 0; n++, _size--) {
+					out[n] = _buf[_head];
+					_head = (_head + 1) % _buf.size();
+				}
+				pthread_cond_broadcast(&_not_full);
+				pthread_mutex_unlock(&_lock);
+				return n;
+			}
+
+		private:
+			ft::vector<size_t>	_buf;
+			size_t				_head;
+			size_t				_size;
+			pthread_mutex_t		_lock;
+			pthread_cond_t		_not_empty;
+			pthread_cond_t		_not_full;
+	};
+
+	template <class Ring>
+	struct job
+	{
+		Ring*	ring;
+		size_t	count;
+		size_t	batch;
+		size_t	sum;
+	};
+
+	template <class Ring>
+	void	*producer(void *arg) {
+		job<Ring>*			j = static_cast<job<Ring>*>(arg);
+		ft::vector<size_t>	items(j->batch);
+
+		for (size_t i = 0; i < j->count; ) {
+			size_t	k = j->count - i < j->batch ? j->count - i : j->batch;
+
+			for (size_t m = 0; m < k; m++)
+				items[m] = i + m;
+			j->ring->push_n(items.data(), k);
+			i += k;
+		}
+		return NULL;
+	}
+
+	template <class Ring>
+	void	*consumer(void *arg) {
+		job<Ring>*			j = static_cast<job<Ring>*>(arg);
+		ft::vector<size_t>	items(j->batch);
+
+		for (size_t i = 0; i < j->count; ) {
+			size_t	k = j->ring->pop_n(items.data(), j->count - i < j->batch ? j->count - i : j->batch);
+
+			for (size_t m = 0; m < k; m++)
+				j->sum += items[m];
+			i += k;
+		}
+		return NULL;
+	}
+
+		// n items from p producers to c consumers, batch at a time
+	template <class Ring>
+	void	throughput(const char *name, size_t n, size_t p, size_t c, size_t batch) {
+		Ring						ring(capacity);
+		ft::vector<job<Ring> >		jobs(p + c);
+		ft::vector<pthread_t>		threads(p + c);
+		std::ostringstream			label;
+		double						start;
+
+		n -= n % (p * c);
+		for (size_t i = 0; i < p + c; i++) {
+			jobs[i].ring = &ring;
+			jobs[i].count = i < p ? n / p : n / c;
+			jobs[i].batch = batch;
+			jobs[i].sum = 0;
+		}
+		start = bench_now();
+		for (size_t i = 0; i < p + c; i++)
+			pthread_create(&threads[i], NULL, i < p ? producer<Ring> : consumer<Ring>, &jobs[i]);
+		for (size_t i = 0; i < p + c; i++)
+			pthread_join(threads[i], NULL);
+		label << name << " " << p << "p/" << c << "c batch " << batch;
+		bench_report(label.str(), bench_now() - start, n);
+		for (size_t i = p; i < p + c; i++)
+			bench_keep(jobs[i].sum);
+	}
+
+	template <class Ring>
+	struct ping_pong
+	{
+		Ring	there;
+		Ring	back;
+		size_t	rounds;
+
+		explicit ping_pong(size_t m) : there(capacity), back(capacity), rounds(m) { }
+	};
+
+	template <class Ring>
+	void	*echo(void *arg) {
+		ping_pong<Ring>*	pp = static_cast<ping_pong<Ring>*>(arg);
+		size_t				x;
+
+		for (size_t i = 0; i < pp->rounds; i++) {
+			pp->there.pop(x);
+			pp->back.push(x);
+		}
+		return NULL;
+	}
+
+		// One element there and back through two spsc rings
+	template <class Wait>
+	void	latency(const char *name, size_t m) {
+		typedef ft::spsc_ring<size_t, Wait>	ring;
+		ping_pong<ring>						pp(m);
+		pthread_t							thread;
+		size_t								x = 0;
+		double								start;
+		std::string							label = std::string("round trip ") + name;
+
+		start = bench_now();
+		pthread_create(&thread, NULL, echo<ring>, &pp);
+		for (size_t i = 0; i < m; i++) {
+			pp.there.push(i);
+			pp.back.pop(x);
+		}
+		pthread_join(thread, NULL);
+		bench_report(label, bench_now() - start, m);
+		bench_keep(x);
+	}
+
+	template <class Wait>
+	void	policy(const char *name, size_t n) {
+		std::string	spsc = std::string("spsc ") + name;
+		std::string	mpmc = std::string("mpmc ") + name;
+
+		throughput<ft::spsc_ring<size_t, Wait> >(spsc.c_str(), n, 1, 1, 1);
+		throughput<ft::spsc_ring<size_t, Wait> >(spsc.c_str(), n, 1, 1, 64);
+		throughput<ft::mpmc_ring<size_t, Wait> >(mpmc.c_str(), n, 1, 1, 1);
+		throughput<ft::mpmc_ring<size_t, Wait> >(mpmc.c_str(), n, 2, 2, 1);
+		throughput<ft::mpmc_ring<size_t, Wait> >(mpmc.c_str(), n, 4, 4, 1);
+		throughput<ft::mpmc_ring<size_t, Wait> >(mpmc.c_str(), n, 4, 4, 64);
+	}
+}
+
+// n items through the rings, per wait policy and producer/consumer counts,
+// against a mutex-guarded ft::vector, then the round trip latency of one
+// element between two threads. Spinning is skipped when there are fewer
+// CPUs than spinning threads: every wait would last a time slice.
+void	bench_ring(size_t n) {
+	size_t	hw = ft::thread_pool::hardware_concurrency();
+
+	bench_title("ring buffer queues", n);
+	throughput<locked_ring>("mutex+vector", n, 1, 1, 1);
+	throughput<locked_ring>("mutex+vector", n, 2, 2, 1);
+	throughput<locked_ring>("mutex+vector", n, 4, 4, 1);
+	if (hw >= 8)
+		policy<ft::spin_wait>("spin", n);
+	policy<ft::yield_wait>("yield", n);
+	policy<ft::futex_wait>("futex", n);
+	if (hw >= 2)
+		latency<ft::spin_wait>("spin", n / 10);
+	latency<ft::yield_wait>("yield", n / 10);
+	latency<ft::futex_wait>("futex", n / 10);
+}
@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_segmented.cpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 18:17:52 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/21 20:02:05 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "vector.hpp"
+#include "segmented_vector.hpp"
+#include <time.h>
+#include <algorithm>
+
+namespace
+{
+	inline long	now_ns() {
+		struct timespec	ts;
+
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		return ts.tv_sec * 1000000000L + ts.tv_nsec;
+	}
+
+	// p50 | p99 | p99.9 | p99.99 | max of n samples, sorted in place
+	void	report_latency(const std::string& name, long *samples, size_t n) {
+		static const double	ranks[] = { 0.5, 0.99, 0.999, 0.9999 };
+
+		std::sort(samples, samples + n);
+		std::cout << "  " << std::left << std::setw(24) << name << std::right;
+		for (size_t r = 0; r < sizeof(ranks) / sizeof(ranks[0]); r++)
+			std::cout << std::setw(10) << samples[static_cast<size_t>(ranks[r] * (n - 1))];
+		std::cout << std::setw(12) << samples[n - 1] << " ns" << std::endl;
+	}
+
+	// Times every push_back on its own, then the whole fill at once
+	template <class Container>
+	void	push_latency(const std::string& name, size_t n, long *samples) {
+		double	start;
+
+		{
+			Container	c;
+			for (size_t i = 0; i < n; i++) {
+				long	t = now_ns();
+				c.push_back(i);
+				samples[i] = now_ns() - t;
+			}
+			bench_keep(c.back());
+		}
+		report_latency(name, samples, n);
+		start = bench_now();
+		{
+			Container	c;
+			for (size_t i = 0; i < n; i++)
+				c.push_back(i);
+			bench_keep(c.back());
+		}
+		bench_report(name + " fill", bench_now() - start, n);
+	}
+
+	template <class Container>
+	void	access(const std::string& name, size_t n) {
+		Container	c;
+		size_t		sum = 0;
+		double		start;
+
+		for (size_t i = 0; i < n; i++)
+			c.push_back(i);
+		start = bench_now();
+		for (typename Container::const_iterator it = c.begin(); it != c.end(); ++it)
+			sum += *it;
+		bench_report(name + " iterate", bench_now() - start, n);
+		start = bench_now();
+		for (size_t i = 0; i < n; i++)
+			sum += c[bench_rand() % n];
+		bench_report(name + " operator[] random", bench_now() - start, n);
+		bench_keep(sum);
+	}
+}
+
+// push_back of n size_t into ft::vector and ft::segmented_vector: the
+// latency percentiles of a single call (each one timed with
+// CLOCK_MONOTONIC, which adds its own ~20 ns) show the copy that
+// ft::vector pays when it grows, then fill, iteration and random
+// indexed reads
+void	bench_segmented(size_t n) {
+	long	*samples = new long[n];
+
+	bench_title("segmented_vector push_back latency", n);
+	std::cout << "  " << std::left << std::setw(24) << "" << std::right
+		<< std::setw(10) << "p50" << std::setw(10) << "p99" << std::setw(10) << "p99.9"
+		<< std::setw(10) << "p99.99" << std::setw(12) << "max" << std::endl;
+	push_latency<ft::vector<size_t> >("ft::vector", n, samples);
+	push_latency<ft::segmented_vector<size_t> >("ft::segmented_vector", n, samples);
+	delete[] samples;
+	bench_title("segmented_vector access", n);
+	access<ft::vector<size_t> >("ft::vector", n);
+	access<ft::segmented_vector<size_t> >("ft::segmented_vector", n);
+}
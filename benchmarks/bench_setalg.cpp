@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_setalg.cpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 00:02:42 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/20 00:02:42 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "bench.hpp"
+#include "map.hpp"
+#include <sstream>
+
+namespace
+{
+	typedef ft::map<size_t, size_t>	map_type;
+
+	std::string	label(const char *op, size_t n, size_t m) {
+		std::ostringstream	os;
+
+		os << op << " " << n << " + " << m;
+		return os.str();
+	}
+
+		// Keys drawn from 2 * n values so about a third of them are shared
+	void	fill(map_type& map, size_t count, size_t n) {
+		while (map.size() < count) {
+			size_t	key = bench_rand() % (2 * n);
+
+			map.insert(ft::make_pair(key, key));
+		}
+	}
+
+	void	run(size_t n, size_t m) {
+		map_type	a;
+		map_type	b;
+		double		start;
+
+		fill(a, n, n);
+		fill(b, m, n);
+		{
+			map_type	x(a);
+
+			start = bench_now();
+			for (map_type::const_iterator it = b.begin(); it != b.end(); ++it)
+				x.insert(*it);
+			bench_report(label("union, insert loop", n, m), bench_now() - start, n + m);
+		}
+		{
+			map_type	x(a);
+			map_type	y(b);
+
+			start = bench_now();
+			x.set_union(y);
+			bench_report(label("set_union", n, m), bench_now() - start, n + m);
+		}
+		{
+			map_type	x(a);
+
+			start = bench_now();
+			for (map_type::iterator it = x.begin(); it != x.end(); )
+				if (b.count(it->first))
+					++it;
+				else
+					x.erase(it++);
+			bench_report(label("intersection, erase loop", n, m), bench_now() - start, n + m);
+		}
+		{
+			map_type	x(a);
+
+			start = bench_now();
+			x.set_intersection(b);
+			bench_report(label("set_intersection", n, m), bench_now() - start, n + m);
+		}
+		{
+			map_type	x(a);
+
+			start = bench_now();
+			for (map_type::const_iterator it = b.begin(); it != b.end(); ++it)
+				x.erase(it->first);
+			bench_report(label("difference, erase loop", n, m), bench_now() - start, n + m);
+		}
+		{
+			map_type	x(a);
+
+			start = bench_now();
+			x.set_difference(b);
+			bench_report(label("set_difference", n, m), bench_now() - start, n + m);
+		}
+	}
+}
+
+// ft::map set algebra against element-by-element insert/erase,
+// for a second map of n, n / 10 and n / 1000 entries
+void	bench_setalg(size_t n) {
+	bench_title("map set algebra", n);
+	run(n, n);
+	run(n, n / 10);
+	run(n, n / 1000 ? n / 1000 : 1);
+}
@@ -0,0 +1,67 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_simd.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:05:57 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/19 16:05:57 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "vector.hpp"
+#include <functional>
+#include <sstream>
+
+namespace
+{
+	const char	*g_levels[] = { "scalar", "sse2", "avx2" };
+
+	std::string	label(const char *type, const char *op, size_t bytes) {
+		std::ostringstream	os;
+
+		os << type << " " << op << " " << bytes << "B";
+		return os.str();
+	}
+
+		// Equal vectors, so both comparisons scan the whole range
+	template <class T>
+	void	sweep(const char *type, size_t max_bytes) {
+		for (size_t bytes = 16; bytes <= max_bytes; bytes *= 4) {
+			size_t			n = bytes / sizeof(T);
+			size_t			reps = (max_bytes * 4) / bytes;
+			ft::vector<T>	a(n, T(1));
+			ft::vector<T>	b(a);
+			double			start;
+
+			start = bench_now();
+			for (size_t i = 0; i < reps; i++)
+				bench_keep(ft::equal(a.begin(), a.end(), b.begin(), std::equal_to<T>()));
+			bench_report(label(type, "equal loop", bytes), bench_now() - start, reps);
+			start = bench_now();
+			for (size_t i = 0; i < reps; i++)
+				bench_keep(a == b);
+			bench_report(label(type, "equal simd", bytes), bench_now() - start, reps);
+			start = bench_now();
+			for (size_t i = 0; i < reps; i++)
+				bench_keep(ft::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end(), std::less<T>()));
+			bench_report(label(type, "less loop", bytes), bench_now() - start, reps);
+			start = bench_now();
+			for (size_t i = 0; i < reps; i++)
+				bench_keep(a < b);
+			bench_report(label(type, "less simd", bytes), bench_now() - start, reps);
+		}
+	}
+}
+
+// ft::vector comparisons through the element loop and the ft::simd kernels,
+// from 16 bytes up to n bytes
+void	bench_simd(size_t n) {
+	bench_title(std::string("simd comparisons, ") + g_levels[ft::simd::cpu_level()], n);
+	sweep<char>("char", n);
+	sweep<int>("int", n);
+	sweep<float>("float", n);
+	sweep<double>("double", n);
+}
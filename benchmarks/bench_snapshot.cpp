@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_snapshot.cpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 06:42:23 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/20 06:42:23 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "bench.hpp"
+#include "snapshot.hpp"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+	typedef ft::map<size_t, size_t>	map_type;
+
+	const char	*g_bin = "/tmp/ft_bench_snapshot.bin";
+	const char	*g_txt = "/tmp/ft_bench_snapshot.txt";
+
+	std::string	label(const char *op, size_t n) {
+		std::ostringstream	os;
+
+		os << op << " " << n;
+		return os.str();
+	}
+
+	void	vector_snapshot(size_t n) {
+		ft::vector<size_t>	v;
+		double				start;
+
+		for (size_t i = 0; i < n; i++)
+			v.push_back(bench_rand());
+		{
+			std::ofstream	os(g_txt);
+
+			start = bench_now();
+			for (size_t i = 0; i < n; i++)
+				os << v[i] << '\n';
+			os.flush();
+			bench_report(label("vector save, text", n), bench_now() - start, n);
+		}
+		{
+			std::ofstream	os(g_bin, std::ios::binary);
+
+			start = bench_now();
+			ft::save_snapshot(os, v);
+			bench_report(label("vector save, snapshot", n), bench_now() - start, n);
+		}
+		{
+			std::ifstream		is(g_txt);
+			ft::vector<size_t>	w;
+			size_t				x;
+
+			start = bench_now();
+			while (is >> x)
+				w.push_back(x);
+			bench_report(label("vector load, text + push_back", n), bench_now() - start, n);
+		}
+		{
+			std::ifstream		is(g_bin, std::ios::binary);
+			ft::vector<size_t>	w;
+
+			start = bench_now();
+			ft::load_snapshot(is, w);
+			bench_report(label("vector load, snapshot", n), bench_now() - start, n);
+			bench_keep(w.back() == v.back());
+		}
+	}
+
+	void	map_snapshot(size_t n) {
+		map_type	m;
+		double		start;
+
+		for (size_t i = 0; i < n; i++)
+			m.insert(ft::make_pair(bench_rand(), i));
+		{
+			std::ofstream	os(g_txt);
+
+			start = bench_now();
+			for (map_type::iterator it = m.begin(); it != m.end(); ++it)
+				os << it->first << ' ' << it->second << '\n';
+			os.flush();
+			bench_report(label("map save, text", m.size()), bench_now() - start, m.size());
+		}
+		{
+			std::ofstream	os(g_bin, std::ios::binary);
+
+			start = bench_now();
+			ft::save_snapshot(os, m);
+			bench_report(label("map save, snapshot", m.size()), bench_now() - start, m.size());
+		}
+		m.clear();
+		{
+			std::ifstream	is(g_txt);
+			map_type		w;
+			size_t			k;
+			size_t			v;
+
+			start = bench_now();
+			while (is >> k >> v)
+				w.insert(ft::make_pair(k, v));
+			bench_report(label("map load, text + insert", w.size()), bench_now() - start, w.size());
+		}
+		{
+			std::ifstream			is(g_bin, std::ios::binary);
+			ft::snapshot_reader		r(is, ft::SNAPSHOT_MAP, sizeof(size_t), sizeof(size_t));
+			map_type				w;
+
+			start = bench_now();
+			w.insert(ft::snapshot_iterator<size_t, size_t>(r), ft::snapshot_iterator<size_t, size_t>());
+			bench_report(label("map load, snapshot + insert", w.size()), bench_now() - start, w.size());
+		}
+		{
+			std::ifstream	is(g_bin, std::ios::binary);
+			map_type		w;
+
+			start = bench_now();
+			ft::load_snapshot(is, w);
+			bench_report(label("map load, snapshot", w.size()), bench_now() - start, w.size());
+		}
+	}
+}
+
+// Reloading a container from a binary snapshot against parsing a text
+// dump and inserting element by element. The files go through the page
+// cache, so this measures decoding and construction, not the disk.
+void	bench_snapshot(size_t n) {
+	bench_title("binary snapshots", n);
+	vector_snapshot(n);
+	map_snapshot(n);
+	remove(g_bin);
+	remove(g_txt);
+}
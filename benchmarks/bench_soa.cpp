@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_soa.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 00:56:56 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/21 02:26:40 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "vector.hpp"
+#include "soa_vector.hpp"
+#include <cstring>
+
+namespace
+{
+	struct tag { char text[32]; };
+
+		// A 64-byte record, and the same fields as columns
+	struct record
+	{
+		size_t		id;
+		double		price;
+		unsigned	qty;
+		unsigned	flags;
+		tag			label;
+	};
+
+	typedef ft::vector<record>									rows;
+	typedef ft::soa_vector<size_t, double, unsigned, unsigned, tag>	columns;
+}
+
+// Filling n records row by row, then scanning one field of them (a sum of
+// the prices, a count of the quantities over a bound): ft::vector of structs
+// against ft::soa_vector, whose scans only read the column they need
+void	bench_soa(size_t n) {
+	rows		aos;
+	columns		soa;
+	record		r;
+	double		start;
+	double		sum;
+	size_t		count;
+
+	bench_title("structure of arrays", n);
+	std::memset(&r, 0, sizeof(r));
+	start = bench_now();
+	for (size_t i = 0; i < n; i++) {
+		r.id = i;
+		r.price = static_cast<double>(bench_rand() % 10000) / 100;
+		r.qty = static_cast<unsigned>(bench_rand() % 1000);
+		aos.push_back(r);
+	}
+	bench_report("vector<record> push_back", bench_now() - start, n);
+	start = bench_now();
+	for (size_t i = 0; i < n; i++)
+		soa.push_back(i, aos[i].price, aos[i].qty, 0, r.label);
+	bench_report("soa_vector push_back", bench_now() - start, n);
+
+	sum = 0;
+	start = bench_now();
+	for (rows::const_iterator it = aos.begin(); it != aos.end(); ++it)
+		sum += it->price;
+	bench_report("vector<record> sum price", bench_now() - start, n);
+	{
+		ft::span<const double>	price = static_cast<const columns&>(soa).column<1>();
+
+		start = bench_now();
+		for (size_t i = 0; i < price.size(); i++)
+			sum -= price[i];
+		bench_report("soa_vector sum price", bench_now() - start, n);
+	}
+	bench_keep(sum == 0);
+
+	count = 0;
+	start = bench_now();
+	for (rows::const_iterator it = aos.begin(); it != aos.end(); ++it)
+		count += it->qty > 500;
+	bench_report("vector<record> count qty", bench_now() - start, n);
+	{
+		ft::span<const unsigned>	qty = static_cast<const columns&>(soa).column<2>();
+
+		start = bench_now();
+		for (size_t i = 0; i < qty.size(); i++)
+			count -= qty[i] > 500;
+		bench_report("soa_vector count qty", bench_now() - start, n);
+	}
+	bench_keep(count);
+}
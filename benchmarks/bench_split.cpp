@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_split.cpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 01:43:15 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/20 01:43:15 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "bench.hpp"
+#include "map.hpp"
+#include <sstream>
+
+namespace
+{
+	typedef ft::map<size_t, size_t>	map_type;
+
+	std::string	label(const char *op, size_t n) {
+		std::ostringstream	os;
+
+		os << op << " " << n;
+		return os.str();
+	}
+
+		// Moves [k, end) of a into b one entry at a time, then back
+	void	move_entries(map_type& a, map_type& b, size_t k) {
+		map_type::iterator	first = a.lower_bound(k);
+
+		for (map_type::iterator it = first; it != a.end(); ++it)
+			b.insert(*it);
+		a.erase(first, a.end());
+		a.insert(b.begin(), b.end());
+		b.clear();
+	}
+}
+
+// ft::map split at a random key and join back, against moving the
+// entries one by one, for maps of 10^3 up to n entries
+void	bench_split(size_t n) {
+	bench_title("map split/join", n);
+	for (size_t size = 1000; size <= n; size *= 10) {
+		map_type	a;
+		map_type	b;
+		size_t		reps = 1000;
+		size_t		slow_reps = n / size < 10 ? 1 : 10;
+		double		start;
+
+		for (size_t i = 0; i < size; i++)
+			a.insert(ft::make_pair(i, i));
+		start = bench_now();
+		for (size_t r = 0; r < reps; r++) {
+			a.split(bench_rand() % size, b);
+			a.join(b);
+		}
+		bench_report(label("split + join", size), bench_now() - start, reps);
+		start = bench_now();
+		for (size_t r = 0; r < slow_reps; r++)
+			move_entries(a, b, bench_rand() % size);
+		bench_report(label("insert + erase loop", size), bench_now() - start, slow_reps);
+	}
+}
@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_threaded.cpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 10:18:26 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/20 10:18:26 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "bench.hpp"
+#include "map.hpp"
+#include <sstream>
+
+namespace
+{
+	std::string	label(const char *kind, const char *op, size_t n) {
+		std::ostringstream	os;
+
+		os << kind << " " << op << " " << n;
+		return os.str();
+	}
+
+		// Inserts n keys, random or ascending (nodes then sit in key order
+		// in memory), then scans forward, backward and by ranges
+	template <class Map>
+	void	scans(const char *kind, size_t n, bool ascending) {
+		Map		m;
+		size_t	sum = 0;
+		size_t	reps = 1000;
+		double	start;
+
+		start = bench_now();
+		for (size_t i = 0; i < n; i++)
+			m.insert(ft::make_pair(ascending ? i : bench_rand(), i));
+		bench_report(label(kind, "insert", n), bench_now() - start, n);
+		start = bench_now();
+		for (typename Map::iterator it = m.begin(); it != m.end(); ++it)
+			sum += it->second;
+		bench_report(label(kind, "forward scan", n), bench_now() - start, m.size());
+		start = bench_now();
+		for (typename Map::reverse_iterator it = m.rbegin(); it != m.rend(); ++it)
+			sum += it->second;
+		bench_report(label(kind, "backward scan", n), bench_now() - start, m.size());
+		for (size_t len = 100; len <= 10000; len *= 100) {
+			std::ostringstream	op;
+			size_t				steps = 0;
+
+			start = bench_now();
+			for (size_t r = 0; r < reps; r++) {
+				typename Map::iterator	it = m.lower_bound(ascending ? bench_rand() % n : bench_rand());
+
+				for (size_t i = 0; i < len && it != m.end(); i++, ++it, ++steps)
+					sum += it->second;
+			}
+			op << "range scans of " << len << ", in";
+			bench_report(label(kind, op.str().c_str(), n), bench_now() - start, steps);
+		}
+		bench_keep(sum);
+	}
+}
+
+// Full and range scans of ft::map with and without in-order threads
+void	bench_threaded(size_t n) {
+	typedef std::less<size_t>								less;
+	typedef std::allocator<ft::pair<const size_t, size_t> >	alloc;
+
+	bench_title("threaded map iteration, random keys", n);
+	scans<ft::map<size_t, size_t, less, alloc, false> >("map", n, false);
+	scans<ft::map<size_t, size_t, less, alloc, true> >("threaded map", n, false);
+	bench_title("threaded map iteration, ascending keys", n);
+	scans<ft::map<size_t, size_t, less, alloc, false> >("map", n, true);
+	scans<ft::map<size_t, size_t, less, alloc, true> >("threaded map", n, true);
+}
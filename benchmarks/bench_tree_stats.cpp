@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_tree_stats.cpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 19:52:16 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/20 19:52:16 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "map.hpp"
+#include <sstream>
+
+namespace
+{
+	typedef ft::map<size_t, size_t>	map;
+
+	std::string	label(const char *order, const char *op, size_t n) {
+		std::ostringstream	os;
+
+		os << op << ", " << order << " keys " << n;
+		return os.str();
+	}
+
+		// Counters of the phase just measured, per operation
+	void	counters(map& m, size_t ops) {
+# ifdef FT_TREE_STATS
+		ft::tree_stats	s = m.stats();
+		double			per = ops ? double(ops) : 1.0;
+
+		std::cout << std::fixed << std::setprecision(2) << "    comparisons " << s.comparisons / per
+			<< "  rotations " << s.rotations / per << "  recolorings " << s.recolorings / per
+			<< "  allocations " << s.allocations / per << "  frees " << s.deallocations / per
+			<< "  descent depth " << s.mean_depth() << " (max " << s.depth_max << ")  (per op)" << std::endl;
+		m.reset_stats();
+# else
+		(void)m;
+		(void)ops;
+# endif
+	}
+
+	void	shape(const map& m) {
+		std::cout << "    shape: " << std::setprecision(2) << m.shape() << std::endl;
+	}
+
+		// Inserts n keys in the given order, finds each, erases every
+		// other one, reporting the work of each phase and the shapes
+	void	phases(const char *order, size_t n) {
+		map					m;
+		ft::vector<size_t>	keys;
+		size_t				sum = 0;
+		double				start;
+
+		for (size_t i = 0; i < n; i++)
+			keys.push_back(order[0] == 'r' ? bench_rand() : order[0] == 'a' ? i : n - i);
+# ifdef FT_TREE_STATS
+		m.reset_stats();
+# endif
+		start = bench_now();
+		for (size_t i = 0; i < n; i++)
+			m.insert(ft::make_pair(keys[i], i));
+		bench_report(label(order, "insert", n), bench_now() - start, n);
+		counters(m, n);
+		shape(m);
+		start = bench_now();
+		for (size_t i = 0; i < n; i++)
+			sum += m.find(keys[(i * 7919) % n])->second;
+		bench_report(label(order, "find", n), bench_now() - start, n);
+		counters(m, n);
+		start = bench_now();
+		for (size_t i = 0; i < n; i += 2)
+			m.erase(keys[i]);
+		bench_report(label(order, "erase half", n), bench_now() - start, (n + 1) / 2);
+		counters(m, (n + 1) / 2);
+		shape(m);
+		bench_keep(sum);
+	}
+}
+
+// What ft::map's red-black tree does per operation: comparator calls,
+// rotations, recolourings, allocations and descent depths (with
+// FT_TREE_STATS, make bench TREE_STATS=1), and the shape it ends up in
+void	bench_tree_stats(size_t n) {
+	bench_title("tree statistics", n);
+# ifndef FT_TREE_STATS
+	std::cout << "  (operation counters off, rebuild with make fclean bench TREE_STATS=1)" << std::endl;
+# endif
+	phases("random", n);
+	phases("ascending", n);
+	phases("descending", n);
+}
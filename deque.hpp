@@ -0,0 +1,557 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   deque.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:56:14 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/19 19:56:14 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+# include <memory>
+# include <cstring>
+# include <stdexcept>
+# include "iterators/DequeIterator.hpp"
+# include "algorithm.hpp"
+# include "type_traits.hpp"
+
+namespace ft
+{
+	/**
+    * ------------------------------------------------------------- *
+    * ------------------------ FT::DEQUE -------------------------- *
+    *
+    * Elements live in fixed-size blocks (deque_block_size) whose
+    * addresses are kept in a map. Adding or removing at either end
+    * is O(1) and never moves an element, so references stay valid
+    * when inserting at the ends. The map is recentred or grown when
+    * one of its ends is reached.
+    *
+    * - Coplien form:
+    * (constructor):        Construct deque
+    * (destructor):         Destruct deque
+    * operator=:            Assign deque
+    *
+    * - Iterators:
+    * begin:                Return iterator to beginning
+    * end:                  Return iterator to end
+    * rbegin:               Return reverse iterator to reverse beginning
+    * rend:                 Return reverse iterator to reverse end
+    *
+    * - Capacity:
+    * size:                 Return size
+    * max_size:             Return maximum size
+    * resize:               Change size
+    * empty:                Test whether deque is empty
+    *
+    * - Element access:
+    * operator[]:           Access element
+    * at:                   Access element
+    * front:                Access first element
+    * back:                 Access last element
+    *
+    * - Modifiers:
+    * assign:               Assign deque content
+    * push_back:            Add element at the end
+    * push_front:           Insert element at beginning
+    * pop_back:             Delete last element
+    * pop_front:            Delete first element
+    * insert:               Insert elements
+    * erase:                Erase elements
+    * swap:                 Swap content
+    * clear:                Clear content
+    *
+    * - Non-member function overloads:
+    * relational operators: Relational operators for deque
+    * swap:                 Exchange contents of two deques
+    * ------------------------------------------------------------- *
+    */
+	template<class T, class Allocator = std::allocator<T> >
+	class deque
+	{
+		public:
+			/* ------------------------------------------------------------- */
+    	    /* -------------------------- ALIASES -------------------------- */
+			typedef	T											value_type;
+			typedef	Allocator									allocator_type;
+			typedef	typename allocator_type::size_type			size_type;
+			typedef typename allocator_type::difference_type	difference_type;
+			typedef	typename allocator_type::reference			reference;
+			typedef	typename allocator_type::const_reference	const_reference;
+			typedef	typename allocator_type::pointer			pointer;
+			typedef	typename allocator_type::const_pointer		const_pointer;
+			typedef	ft::DequeIterator<value_type>				iterator;
+			typedef	ft::DequeIterator<const value_type>			const_iterator;
+			typedef	ft::reverse_iterator<iterator>				reverse_iterator;
+			typedef	ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+
+		protected:
+			typedef typename Allocator::template rebind<pointer>::other	map_allocator;
+			typedef pointer*											map_pointer;
+
+    	    /* ------------------------------------------------------------- */
+    	    /* ------------------------- ATTRIBUTES ------------------------ */
+			allocator_type	_alloc;
+			map_allocator	_map_alloc;
+			map_pointer		_map;
+			size_type		_map_size;
+			iterator		_start;
+			iterator		_finish;
+
+		public:
+    	    /* ------------------------------------------------------------- */
+    	    /* ---------------------------- BODY --------------------------- */
+
+ 			/* ------------------------------------------------------------- */
+            /**
+            *   Default constructor, creates an empty deque. No memory is
+            *   allocated until the first insertion.
+            *
+            *   @param alloc    The template param used for the allocation.
+            */
+            /* ------------------------------------------------------------- */
+
+			explicit deque ( const allocator_type& alloc = allocator_type() )
+							: _alloc(alloc), _map_alloc(alloc), _map(nullptr), _map_size(0) { }
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Fill constructor, creates a deque of n copies of val.
+            */
+            /* ------------------------------------------------------------- */
+
+			explicit deque ( size_type n, const value_type& val = value_type(),
+							const allocator_type& alloc = allocator_type() )
+								: _alloc(alloc), _map_alloc(alloc), _map(nullptr), _map_size(0) {
+				assign(n, val);
+			}
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Range constructor, copies the elements of [first, last).
+            */
+            /* ------------------------------------------------------------- */
+
+			template <class InputIterator>
+			deque ( InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type * = NULL)
+					: _alloc(alloc), _map_alloc(alloc), _map(nullptr), _map_size(0) {
+				assign(first, last);
+			}
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Copy constructor.
+            */
+            /* ------------------------------------------------------------- */
+
+			deque ( const deque& x ) : _alloc(x._alloc), _map_alloc(x._map_alloc), _map(nullptr), _map_size(0) {
+				assign(x.begin(), x.end());
+			}
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Destructor, destroys all the elements and frees the blocks and the map.
+            */
+            /* ------------------------------------------------------------- */
+
+			~deque() {
+				if (_map == nullptr)
+					return ;
+				clear();
+				_alloc.deallocate(*_start.node(), _block());
+				_map_alloc.deallocate(_map, _map_size);
+			}
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Assigns a deque to this deque, reusing the elements in place.
+            */
+            /* ------------------------------------------------------------- */
+
+			deque& operator=( const deque& x ) {
+				if (this == &x)
+					return *this;
+				const_iterator	src = x.begin();
+				for (iterator dst = begin(); dst != end() && src != x.end(); ++dst, ++src)
+					*dst = *src;
+				for ( ; src != x.end(); ++src)
+					push_back(*src);
+				while (size() > x.size())
+					pop_back();
+				return *this;
+			}
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Fill and range assign, replace the content of the deque.
+            */
+            /* ------------------------------------------------------------- */
+
+			void	assign(size_type count, const value_type& val) {
+				value_type	copy(val);
+
+				clear();
+				for ( ; count != 0; --count)
+					push_back(copy);
+			}
+
+			template <class InputIterator>
+			void	assign(InputIterator first, InputIterator last,
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type * = NULL) {
+				clear();
+				for ( ; first != last; ++first)
+					push_back(*first);
+			}
+
+			/* ------------------------------------------------------------- */
+
+			allocator_type	get_allocator() const { return _alloc; }
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Element access, O(1): one division to find the block.
+            */
+            /* ------------------------------------------------------------- */
+
+			reference	at(size_type pos) {
+				if (pos >= size())
+					throw std::out_of_range("ft::deque");
+				return _start[pos];
+			}
+
+			const_reference	at(size_type pos) const {
+				if (pos >= size())
+					throw std::out_of_range("ft::deque");
+				return begin()[pos];
+			}
+
+			reference		operator[](size_type pos)		{ return _start[pos]; }
+			const_reference	operator[](size_type pos) const	{ return begin()[pos]; }
+			reference 		front()							{ return *_start; }
+			const_reference front() const					{ return *_start; }
+			reference		back() 							{ return *(_finish - 1); }
+			const_reference	back() const					{ return *(_finish - 1); }
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Iterators
+            */
+            /* ------------------------------------------------------------- */
+
+			iterator				begin()			{ return _start; }
+			const_iterator 			begin() const	{ return _start; }
+			iterator				end()			{ return _finish; }
+			const_iterator			end() const 	{ return _finish; }
+			reverse_iterator		rbegin()		{ return reverse_iterator(end()); }
+			const_reverse_iterator	rbegin() const	{ return const_reverse_iterator(end()); }
+			reverse_iterator		rend()			{ return reverse_iterator(begin()); }
+			const_reverse_iterator	rend() const	{ return const_reverse_iterator(begin()); }
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Capacity
+            */
+            /* ------------------------------------------------------------- */
+
+			bool		empty() const		{ return _start == _finish; }
+			size_type	size() const		{ return _finish - _start; }
+			size_type	max_size() const	{ return _alloc.max_size(); }
+
+			void	resize(size_type n, value_type val = value_type()) {
+				while (size() > n)
+					pop_back();
+				while (size() < n)
+					push_back(val);
+			}
+
+            /* ------------------------------------------------------------- */
+            /**
+            *     Modifiers
+            */
+            /* ------------------------------------------------------------- */
+
+			void	push_back(const value_type& val) {
+				if (_map == nullptr)
+					_initialize_map();
+				if (_finish.base() != _finish.node()[0] + _block() - 1) {
+					_alloc.construct(_finish.base(), val);
+					++_finish;
+					return ;
+				}
+				_reserve_map(1, false);
+				_finish.node()[1] = _alloc.allocate(_block());
+				try {
+					_alloc.construct(_finish.base(), val);
+				}
+				catch(...) {
+					_alloc.deallocate(_finish.node()[1], _block());
+					throw;
+				}
+				++_finish;
+			}
+
+			/* ------------------------------------------------------------- */
+
+			void	push_front(const value_type& val) {
+				if (_map == nullptr)
+					_initialize_map();
+				if (_start.base() != _start.node()[0]) {
+					_alloc.construct(_start.base() - 1, val);
+					--_start;
+					return ;
+				}
+				_reserve_map(1, true);
+				_start.node()[-1] = _alloc.allocate(_block());
+				try {
+					_alloc.construct(_start.node()[-1] + _block() - 1, val);
+				}
+				catch(...) {
+					_alloc.deallocate(_start.node()[-1], _block());
+					throw;
+				}
+				--_start;
+			}
+
+			/* ------------------------------------------------------------- */
+
+			void	pop_back() {
+				if (_finish.base() == _finish.node()[0])
+					_alloc.deallocate(_finish.node()[0], _block());
+				--_finish;
+				_alloc.destroy(_finish.base());
+			}
+
+			/* ------------------------------------------------------------- */
+
+			void	pop_front() {
+				_alloc.destroy(_start.base());
+				if (_start.base() == _start.node()[0] + _block() - 1)
+					_alloc.deallocate(_start.node()[0], _block());
+				++_start;
+			}
+
+			/* ------------------------------------------------------------- */
+
+			iterator	insert(iterator position, const value_type& val) {
+				size_type	idx = position - _start;
+
+				if (idx == 0) {
+					push_front(val);
+					return _start;
+				}
+				if (idx == size()) {
+					push_back(val);
+					return _finish - 1;
+				}
+				value_type	copy(val);
+				_open_gap(idx, 1, copy);
+				_start[idx] = copy;
+				return _start + idx;
+			}
+
+			/* ------------------------------------------------------------- */
+
+			void	insert(iterator position, size_type n, const value_type& val) {
+				size_type	idx = position - _start;
+				value_type	copy(val);
+
+				if (n == 0)
+					return ;
+				_open_gap(idx, n, copy);
+				for (iterator it = _start + idx, last = it + n; it != last; ++it)
+					*it = copy;
+			}
+
+			/* ------------------------------------------------------------- */
+
+			template <class InputIterator>
+			void	insert(iterator position, InputIterator first, InputIterator last,
+						typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type * = NULL) {
+				size_type	idx = position - _start;
+
+				if (first == last)
+					return ;
+				deque	tmp(first, last, _alloc);
+				_open_gap(idx, tmp.size(), tmp.front());
+				for (iterator it = _start + idx, src = tmp.begin(); src != tmp.end(); ++it, ++src)
+					*it = *src;
+			}
+
+			/* ------------------------------------------------------------- */
+
+			iterator	erase(iterator position) {
+				return erase(position, position + 1);
+			}
+
+			/* ------------------------------------------------------------- */
+
+			// Shifts whichever side of the hole is shorter
+			iterator	erase(iterator first, iterator last) {
+				size_type	idx = first - _start;
+				size_type	n = last - first;
+
+				if (n == 0)
+					return first;
+				if (idx < (size() - n) / 2) {
+					for (iterator src = first, dst = last; src != _start; )
+						*--dst = *--src;
+					for ( ; n != 0; --n)
+						pop_front();
+				}
+				else {
+					for (iterator src = last, dst = first; src != _finish; ++src, ++dst)
+						*dst = *src;
+					for ( ; n != 0; --n)
+						pop_back();
+				}
+				return _start + idx;
+			}
+
+			/* ------------------------------------------------------------- */
+
+			void	swap(deque& x) {
+				ft::swap(_alloc, x._alloc);
+				ft::swap(_map_alloc, x._map_alloc);
+				ft::swap(_map, x._map);
+				ft::swap(_map_size, x._map_size);
+				ft::swap(_start, x._start);
+				ft::swap(_finish, x._finish);
+			}
+
+			/* ------------------------------------------------------------- */
+
+			// Keeps the first block and the map for the next insertions
+			void	clear() {
+				if (_map == nullptr)
+					return ;
+				for (iterator it = _start; it != _finish; ++it)
+					_alloc.destroy(it.base());
+				for (map_pointer node = _start.node() + 1; node <= _finish.node(); ++node)
+					_alloc.deallocate(*node, _block());
+				_finish = _start;
+			}
+
+            /* ------------------------------------------------------------- */
+            /**
+            *      PRIVATE Utils functions
+            */
+            /* ------------------------------------------------------------- */
+		private:
+			static size_type	_block() { return deque_block_size<value_type>(); }
+
+			/* ------------------------------------------------------------- */
+
+			// One block in the middle of an 8 slot map
+			void	_initialize_map() {
+				_map_size = 8;
+				_map = _map_alloc.allocate(_map_size);
+				try {
+					_map[_map_size / 2] = _alloc.allocate(_block());
+				}
+				catch(...) {
+					_map_alloc.deallocate(_map, _map_size);
+					_map = nullptr;
+					throw;
+				}
+				_start = iterator(_map[_map_size / 2] + _block() / 2, _map + _map_size / 2);
+				_finish = _start;
+			}
+
+			/* ------------------------------------------------------------- */
+
+			// Makes room for n more block slots before the first or after the last
+			// block, by recentring the blocks when the map is at most half full,
+			// or by moving them to a bigger map
+			void	_reserve_map(size_type n, bool front) {
+				size_type	first = _start.node() - _map;
+				size_type	used = _finish.node() - _start.node() + 1;
+
+				if (front ? n <= first : first + used + n <= _map_size)
+					return ;
+				size_type	needed = used + n;
+				map_pointer	new_start;
+				if (_map_size > 2 * needed) {
+					new_start = _map + (_map_size - needed) / 2 + (front ? n : 0);
+					memmove(new_start, _start.node(), used * sizeof(pointer));
+				}
+				else {
+					size_type	new_size = _map_size + (_map_size > n ? _map_size : n) + 2;
+					map_pointer	new_map = _map_alloc.allocate(new_size);
+					new_start = new_map + (new_size - needed) / 2 + (front ? n : 0);
+					memcpy(new_start, _start.node(), used * sizeof(pointer));
+					_map_alloc.deallocate(_map, _map_size);
+					_map = new_map;
+					_map_size = new_size;
+				}
+				_start = iterator(_start.base(), new_start);
+				_finish = iterator(_finish.base(), new_start + used - 1);
+			}
+
+			/* ------------------------------------------------------------- */
+
+			// Opens n slots at idx by growing the shorter side with copies of
+			// filler and shifting that side's elements. The slots keep stale values.
+			void	_open_gap(size_type idx, size_type n, const value_type& filler) {
+				size_type	old_size = size();
+
+				if (idx < old_size / 2) {
+					for (size_type i = 0; i < n; i++)
+						push_front(filler);
+					for (iterator dst = _start, src = _start + n, last = src + idx; src != last; ++src, ++dst)
+						*dst = *src;
+				}
+				else {
+					for (size_type i = 0; i < n; i++)
+						push_back(filler);
+					for (iterator src = _start + old_size, dst = _finish, first = _start + idx; src != first; )
+						*--dst = *--src;
+				}
+			}
+	};
+
+	template <class T, class Alloc>
+	void	swap(deque<T,Alloc>& x, deque<T,Alloc>& y) {
+		x.swap(y);
+	}
+
+    /* ------------------------------------------------------------- */
+    /**
+    *   Relational operators
+    */
+    /* ------------------------------------------------------------- */
+
+	template <class T, class Alloc>
+	bool operator==(const deque<T,Alloc>& lhs, const deque<T,Alloc>& rhs) {
+		return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+
+	template <class T, class Alloc>
+	bool operator<(const deque<T,Alloc>& lhs, const deque<T,Alloc>& rhs) {
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	}
+
+	template <class T, class Alloc>
+	bool	operator>(const deque<T,Alloc>& lhs, const deque<T,Alloc>& rhs) {
+		return rhs < lhs;
+	}
+
+	template <class T, class Alloc>
+	bool	operator!=(const deque<T,Alloc>& lhs, const deque<T,Alloc>& rhs) {
+		return !(lhs == rhs);
+	}
+
+	template <class T, class Alloc>
+	bool	operator<=(const deque<T,Alloc>& lhs, const deque<T,Alloc>& rhs) {
+		return !(rhs < lhs);
+	}
+
+	template <class T, class Alloc>
+	bool	operator>=(const deque<T,Alloc>& lhs, const deque<T,Alloc>& rhs) {
+		return !(lhs < rhs);
+	}
+}
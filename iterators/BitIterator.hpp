@@ -0,0 +1,151 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   BitIterator.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 03:33:59 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/21 05:29:36 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+# include <stddef.h>
+# include <stdint.h>
+# include "iterator.hpp"
+
+namespace ft
+{
+	// Bits of ft::vector<bool> are packed in 64-bit words, bit i of the
+	// vector being bit i % 64 of word i / 64.
+	typedef uint64_t	bit_word;
+
+	static const unsigned	bit_word_bits = 64;
+
+	//BIT REFERENCE
+		// Proxy for one bit, what vector<bool>::operator[] returns
+	class BitReference {
+	public:
+		BitReference(bit_word* word, unsigned bit) : _word(word), _mask(bit_word(1) << bit) { }
+		BitReference(const BitReference& x) : _word(x._word), _mask(x._mask) { }
+
+		operator bool() const { return (*_word & _mask) != 0; }
+		bool	operator~() const { return (*_word & _mask) == 0; }
+
+		BitReference&	operator=(bool x) {
+			if (x)
+				*_word |= _mask;
+			else
+				*_word &= ~_mask;
+			return *this;
+		}
+		BitReference&	operator=(const BitReference& x) { return *this = bool(x); }
+		void	flip() { *_word ^= _mask; }
+
+	private:
+		bit_word*	_word;
+		bit_word	_mask;
+	};
+
+	//BIT ITERATORS
+		// Position shared by the mutable and the const iterator
+	class BitIteratorBase {
+	public:
+		typedef random_access_iterator_tag	iterator_category;
+		typedef bool						value_type;
+		typedef std::ptrdiff_t				difference_type;
+
+		BitIteratorBase(bit_word* word, unsigned bit) : _word(word), _bit(bit) { }
+
+		bit_word*	word() const { return _word; }
+		unsigned	bit() const { return _bit; }
+
+		friend difference_type	operator-(const BitIteratorBase& x, const BitIteratorBase& y) {
+			return (x._word - y._word) * difference_type(bit_word_bits) + difference_type(x._bit) - difference_type(y._bit);
+		}
+		friend bool	operator==(const BitIteratorBase& x, const BitIteratorBase& y) {
+			return x._word == y._word && x._bit == y._bit;
+		}
+		friend bool	operator!=(const BitIteratorBase& x, const BitIteratorBase& y) { return !(x == y); }
+		friend bool	operator<(const BitIteratorBase& x, const BitIteratorBase& y) {
+			return x._word < y._word || (x._word == y._word && x._bit < y._bit);
+		}
+		friend bool	operator>(const BitIteratorBase& x, const BitIteratorBase& y) { return y < x; }
+		friend bool	operator<=(const BitIteratorBase& x, const BitIteratorBase& y) { return !(y < x); }
+		friend bool	operator>=(const BitIteratorBase& x, const BitIteratorBase& y) { return !(x < y); }
+
+	protected:
+		bit_word*	_word;
+		unsigned	_bit;
+
+		void	_incr() {
+			if (++_bit == bit_word_bits) {
+				_bit = 0;
+				++_word;
+			}
+		}
+		void	_decr() {
+			if (_bit-- == 0) {
+				_bit = bit_word_bits - 1;
+				--_word;
+			}
+		}
+		void	_advance(difference_type n) {
+			difference_type	k = n + difference_type(_bit);
+
+			_word += k / difference_type(bit_word_bits);
+			k %= difference_type(bit_word_bits);
+			if (k < 0) {
+				k += bit_word_bits;
+				--_word;
+			}
+			_bit = static_cast<unsigned>(k);
+		}
+	};
+
+	class BitIterator : public BitIteratorBase {
+	public:
+		typedef BitReference	reference;
+		typedef BitReference*	pointer;
+
+		BitIterator() : BitIteratorBase(NULL, 0) { }
+		BitIterator(bit_word* word, unsigned bit) : BitIteratorBase(word, bit) { }
+
+		reference		operator*() const { return reference(_word, _bit); }
+		reference		operator[](difference_type n) const { return *(*this + n); }
+		BitIterator&	operator++() { _incr(); return *this; }
+		BitIterator		operator++(int) { BitIterator tmp = *this; _incr(); return tmp; }
+		BitIterator&	operator--() { _decr(); return *this; }
+		BitIterator		operator--(int) { BitIterator tmp = *this; _decr(); return tmp; }
+		BitIterator&	operator+=(difference_type n) { _advance(n); return *this; }
+		BitIterator&	operator-=(difference_type n) { _advance(-n); return *this; }
+		BitIterator		operator+(difference_type n) const { BitIterator tmp = *this; return tmp += n; }
+		BitIterator		operator-(difference_type n) const { BitIterator tmp = *this; return tmp -= n; }
+	};
+
+	class BitConstIterator : public BitIteratorBase {
+	public:
+		typedef bool			reference;
+		typedef const bool*		pointer;
+
+		BitConstIterator() : BitIteratorBase(NULL, 0) { }
+		BitConstIterator(const bit_word* word, unsigned bit) : BitIteratorBase(const_cast<bit_word*>(word), bit) { }
+		BitConstIterator(const BitIterator& x) : BitIteratorBase(x.word(), x.bit()) { }
+
+		reference			operator*() const { return (*_word >> _bit) & 1; }
+		reference			operator[](difference_type n) const { return *(*this + n); }
+		BitConstIterator&	operator++() { _incr(); return *this; }
+		BitConstIterator	operator++(int) { BitConstIterator tmp = *this; _incr(); return tmp; }
+		BitConstIterator&	operator--() { _decr(); return *this; }
+		BitConstIterator	operator--(int) { BitConstIterator tmp = *this; _decr(); return tmp; }
+		BitConstIterator&	operator+=(difference_type n) { _advance(n); return *this; }
+		BitConstIterator&	operator-=(difference_type n) { _advance(-n); return *this; }
+		BitConstIterator	operator+(difference_type n) const { BitConstIterator tmp = *this; return tmp += n; }
+		BitConstIterator	operator-(difference_type n) const { BitConstIterator tmp = *this; return tmp -= n; }
+	};
+
+	inline BitIterator		operator+(BitIterator::difference_type n, const BitIterator& x) { return x + n; }
+	inline BitConstIterator	operator+(BitConstIterator::difference_type n, const BitConstIterator& x) { return x + n; }
+}
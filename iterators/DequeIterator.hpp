@@ -0,0 +1,192 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   DequeIterator.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:39:30 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/19 19:39:30 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+# include <cstddef>
+# include "iterator.hpp"
+# include "../type_traits.hpp"
+
+namespace ft
+{
+	// Elements per deque block: 4 KiB worth, at least 16
+	template <class T>
+	inline size_t	deque_block_size() {
+		return sizeof(T) < 256 ? 4096 / sizeof(T) : 16;
+	}
+
+	//DEQUE ITERATORS
+		// _node is the slot of the current block in the deque's map,
+		// [_first, _last) that block and _cur the element.
+	template <class T>
+	class DequeIterator {
+	public:
+		typedef typename ft::remove_const<T>::type							value_type;
+		typedef T*															pointer;
+		typedef T&															reference;
+    	typedef std::ptrdiff_t												difference_type;
+		typedef typename ft::random_access_iterator_tag						iterator_category;
+		typedef value_type**												map_pointer;
+
+	// CONSTRUCTORS
+		// 1) Default
+		DequeIterator() : _cur(nullptr), _first(nullptr), _last(nullptr), _node(nullptr) { }
+		// 2) Initialization
+		DequeIterator(pointer cur, map_pointer node) : _cur(cur), _first(*node),
+													_last(*node + deque_block_size<T>()), _node(node) { }
+		// 3) Copy
+		DequeIterator ( const DequeIterator& x ) : _cur(x._cur), _first(x._first), _last(x._last), _node(x._node) { }
+	// ASSIGN OPERATOR
+		DequeIterator& operator=( const DequeIterator& x ) {
+			_cur = x._cur;
+			_first = x._first;
+			_last = x._last;
+			_node = x._node;
+			return	*this;
+		}
+	// DESTRUCTOR
+		~DequeIterator() { }
+	// MEMBER FUNCTIONS
+		// Base - returns the current element
+		pointer	base() const {
+			return _cur;
+		}
+		map_pointer	node() const {
+			return _node;
+		}
+		// Moves to another block, the position inside it is left to the caller
+		void	set_node(map_pointer node) {
+			_node = node;
+			_first = *node;
+			_last = _first + deque_block_size<T>();
+		}
+		// Pre-increment iterator position
+		DequeIterator&	operator++() {
+			if (++_cur == _last) {
+				set_node(_node + 1);
+				_cur = _first;
+			}
+			return *this;
+		}
+		// Post-increment iterator position
+		DequeIterator	operator++(int) {
+			DequeIterator temp = *this;
+			++(*this);
+			return temp;
+		}
+		// Dereference iterator
+		reference	operator*() const {
+			return *_cur;
+		}
+		// Dereference iterator
+		pointer operator->() const {
+			return _cur;
+		}
+		// Pre-decrement iterator position
+		DequeIterator&	operator--() {
+			if (_cur == _first) {
+				set_node(_node - 1);
+				_cur = _last;
+			}
+			--_cur;
+			return *this;
+		}
+		// Post-decrement iterator position
+		DequeIterator	operator--(int) {
+			DequeIterator temp = *this;
+			--(*this);
+			return temp;
+		}
+		// Advance iterator
+		DequeIterator&	operator+= (difference_type n) {
+			difference_type	block = deque_block_size<T>();
+			difference_type	offset = n + (_cur - _first);
+
+			if (offset >= 0 && offset < block) {
+				_cur += n;
+				return *this;
+			}
+			difference_type	nodes = offset > 0 ? offset / block : -((-offset - 1) / block) - 1;
+			set_node(_node + nodes);
+			_cur = _first + (offset - nodes * block);
+			return *this;
+		}
+		// Addition operator
+		DequeIterator	operator+ (difference_type n) const {
+			DequeIterator temp = *this;
+			return temp += n;
+		}
+		// Retrocede iterator
+		DequeIterator&	operator-= (difference_type n) {
+			return *this += -n;
+		}
+		// Subtraction operator
+		DequeIterator	operator- (difference_type n) const {
+			DequeIterator temp = *this;
+			return temp += -n;
+		}
+		// Dereference iterator with offset
+		reference	operator[] (difference_type n) const {
+			return *(*this + n);
+		}
+		// Distance, iterators in the same block compare their elements
+		template <class U>
+		difference_type	operator- (const DequeIterator<U>& x) const {
+			if (_node == x.node())
+				return _cur - x.base();
+			return difference_type(deque_block_size<T>()) * (_node - x.node() - 1)
+					+ (_cur - _first) + (x.node()[0] + deque_block_size<T>() - x.base());
+		}
+		// Constant cast overload
+		operator DequeIterator<const T>() const {
+			if (_node == nullptr)
+				return DequeIterator<const T>();
+			return DequeIterator<const T>(_cur, _node);
+		}
+	protected:
+		pointer			_cur;
+		pointer			_first;
+		pointer			_last;
+		map_pointer		_node;
+	};
+
+	//RELATIONAL OPERATORS
+	template <class T, class T1>
+	bool operator==(const DequeIterator<T>& lhs, const DequeIterator<T1>& rhs) {
+		return lhs.base() == rhs.base();
+	}
+	template <class T, class T1>
+	bool operator!=(const DequeIterator<T>& lhs, const DequeIterator<T1>& rhs) {
+		return lhs.base() != rhs.base();
+	}
+	template <class T, class T1>
+	bool operator<(const DequeIterator<T>& lhs, const DequeIterator<T1>& rhs) {
+		return lhs.node() == rhs.node() ? lhs.base() < rhs.base() : lhs.node() < rhs.node();
+	}
+	template <class T, class T1>
+	bool operator>(const DequeIterator<T>& lhs, const DequeIterator<T1>& rhs) {
+		return rhs < lhs;
+	}
+	template <class T, class T1>
+	bool operator<=(const DequeIterator<T>& lhs, const DequeIterator<T1>& rhs) {
+		return !(rhs < lhs);
+	}
+	template <class T, class T1>
+	bool operator>=(const DequeIterator<T>& lhs, const DequeIterator<T1>& rhs) {
+		return !(lhs < rhs);
+	}
+	// ADVANCES THE ITERATOR
+	template<class T>
+	DequeIterator<T>	operator+( typename DequeIterator<T>::difference_type n, const DequeIterator<T>& it ) {
+		return it + n;
+	}
+}
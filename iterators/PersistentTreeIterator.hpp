@@ -0,0 +1,151 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   PersistentTreeIterator.hpp                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:09:23 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/19 11:09:23 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+# include <cstddef>
+# include "iterator.hpp"
+
+// Upper bound of a red-black tree height: 2 * log2(n + 1), enough for 2^48 nodes
+# ifndef FT_PTREE_MAX_HEIGHT
+#  define FT_PTREE_MAX_HEIGHT 96
+# endif
+
+namespace ft
+{
+	//PERSISTENT NODE STRUCT
+		// Nodes are shared between versions of the tree, so they have no parent
+		// pointer and carry a reference count instead.
+	template <typename T>
+	struct PNode
+	{
+		T			value;
+		PNode*		left;
+		PNode*		right;
+		size_t		refs;
+		bool		red;
+	};
+	//PERSISTENT MAP ITERATORS
+		// Without parent pointers the iterator keeps the path from the root to the
+		// current node. An empty path is end(). Iterators are read-only: the
+		// nodes they point to may be shared with other snapshots.
+	template <class T, class TNode>
+	class PersistentTreeIterator {
+	public:
+		typedef T															value_type;
+		typedef	TNode														node_type;
+		typedef const T*													pointer;
+		typedef const T&													reference;
+    	typedef ptrdiff_t													difference_type;
+		typedef typename ft::bidirectional_iterator_tag						iterator_category;
+		typedef size_t														size_type;
+
+	// CONSTRUCTORS
+		// 1) Default
+		PersistentTreeIterator() : _root(nullptr), _depth(0) { }
+		// 2) Initialization, positioned at end()
+		explicit PersistentTreeIterator(const node_type* root) : _root(root), _depth(0) { }
+		// 3) Copy
+		PersistentTreeIterator(const PersistentTreeIterator& x) : _root(x._root), _depth(x._depth) {
+			for (size_type i = 0; i < _depth; i++)
+				_path[i] = x._path[i];
+		}
+	// ASSIGN OPERATOR
+		PersistentTreeIterator& operator=( const PersistentTreeIterator& x ) {
+			if (this != &x) {
+				_root = x._root;
+				_depth = x._depth;
+				for (size_type i = 0; i < _depth; i++)
+					_path[i] = x._path[i];
+			}
+			return	*this;
+		}
+	// DESTRUCTOR
+		~PersistentTreeIterator() { }
+	// MEMBER FUNCTIONS
+		// Base - returns the current node, nullptr for end()
+		const node_type*	base() const {
+			if (_depth == 0)
+				return nullptr;
+			return _path[_depth - 1];
+		}
+		// Used by the tree to build the path while searching
+		void	push(const node_type* node) {
+			_path[_depth++] = node;
+		}
+		void	leftmost(const node_type* node) {
+			for ( ; node != nullptr; node = node->left)
+				push(node);
+		}
+		void	rightmost(const node_type* node) {
+			for ( ; node != nullptr; node = node->right)
+				push(node);
+		}
+		size_type	depth() const { return _depth; }
+		void		truncate(size_type depth) { _depth = depth; }
+		// Pre-increment iterator position
+		PersistentTreeIterator&	operator++() {
+			const node_type* cur = _path[_depth - 1];
+			if (cur->right != nullptr) {
+				leftmost(cur->right);
+				return *this;
+			}
+			for (--_depth; _depth != 0 && _path[_depth - 1]->right == cur; --_depth)
+				cur = _path[_depth - 1];
+			return *this;
+		}
+		// Post-increment iterator position
+		PersistentTreeIterator	operator++(int) {
+			PersistentTreeIterator temp = *this;
+			++(*this);
+			return temp;
+		}
+		// Pre-decrement iterator position
+		PersistentTreeIterator&	operator--() {
+			if (_depth == 0) {
+				rightmost(_root);
+				return *this;
+			}
+			const node_type* cur = _path[_depth - 1];
+			if (cur->left != nullptr) {
+				rightmost(cur->left);
+				return *this;
+			}
+			for (--_depth; _depth != 0 && _path[_depth - 1]->left == cur; --_depth)
+				cur = _path[_depth - 1];
+			return *this;
+		}
+		// Post-decrement iterator position
+		PersistentTreeIterator	operator--(int) {
+			PersistentTreeIterator temp = *this;
+			--(*this);
+			return temp;
+		}
+		// Dereference iterator
+		reference	operator*() const {
+			return _path[_depth - 1]->value;
+		}
+		pointer operator->() const {
+			return &(_path[_depth - 1]->value);
+		}
+		bool operator==(const PersistentTreeIterator& x) const {
+			return base() == x.base();
+		}
+		bool operator!=(const PersistentTreeIterator& x) const {
+			return base() != x.base();
+		}
+	protected:
+		const node_type*	_root;
+		const node_type*	_path[FT_PTREE_MAX_HEIGHT];
+		size_type			_depth;
+	};
+}
@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   SegmentedIterator.hpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 17:39:24 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/21 19:34:42 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+# include <stddef.h>
+# include "iterator.hpp"
+
+namespace ft
+{
+	// Layout of ft::segmented_vector: segment k holds 16 << k elements,
+	// so element i sits in segment log2(i / 16 + 1), found in O(1)
+	namespace segments
+	{
+		static const unsigned	shift = 4;
+		static const size_t		max_count = sizeof(size_t) * 8 - shift;
+
+		inline size_t	index_of(size_t i) {
+			return sizeof(unsigned long long) * 8 - 1 - static_cast<size_t>(__builtin_clzll((i >> shift) + 1));
+		}
+		inline size_t	first_of(size_t k) { return ((size_t(1) << k) - 1) << shift; }
+		inline size_t	size_of(size_t k) { return size_t(1) << (k + shift); }
+
+		template <class T>
+		T&	at(T* const* table, size_t i) {
+			size_t	k = index_of(i);
+
+			return table[k][i - first_of(k)];
+		}
+	}
+
+	//SEGMENTED ITERATORS
+		// A position in the segment table
+	template <class T>
+	class SegmentedIterator {
+	public:
+		typedef T								value_type;
+		typedef std::ptrdiff_t					difference_type;
+		typedef T*								pointer;
+		typedef T&								reference;
+		typedef random_access_iterator_tag		iterator_category;
+
+	// CONSTRUCTORS
+		SegmentedIterator() : _table(NULL), _i(0) { }
+		SegmentedIterator(T* const* table, size_t i) : _table(table), _i(i) { }
+		SegmentedIterator(const SegmentedIterator& x) : _table(x._table), _i(x._i) { }
+	// ASSIGN OPERATOR
+		SegmentedIterator&	operator=(const SegmentedIterator& x) {
+			_table = x._table;
+			_i = x._i;
+			return *this;
+		}
+	// MEMBER FUNCTIONS
+		// Index in the container
+		size_t	index() const { return _i; }
+		T* const*	table() const { return _table; }
+		reference	operator*() const { return segments::at(_table, _i); }
+		pointer		operator->() const { return &segments::at(_table, _i); }
+		reference	operator[](difference_type n) const { return segments::at(_table, _i + n); }
+		SegmentedIterator&	operator++() { ++_i; return *this; }
+		SegmentedIterator	operator++(int) { SegmentedIterator tmp = *this; ++_i; return tmp; }
+		SegmentedIterator&	operator--() { --_i; return *this; }
+		SegmentedIterator	operator--(int) { SegmentedIterator tmp = *this; --_i; return tmp; }
+		SegmentedIterator	operator+(difference_type n) const { return SegmentedIterator(_table, _i + n); }
+		SegmentedIterator&	operator+=(difference_type n) { _i += n; return *this; }
+		SegmentedIterator	operator-(difference_type n) const { return SegmentedIterator(_table, _i - n); }
+		SegmentedIterator&	operator-=(difference_type n) { _i -= n; return *this; }
+		// Constant cast overload
+		operator SegmentedIterator<const T>() const {
+			return SegmentedIterator<const T>(_table, _i);
+		}
+	protected:
+		T* const*	_table;
+		size_t		_i;
+	};
+
+	//RELATIONAL OPERATORS
+	template <class T, class T1>
+	bool operator==(const SegmentedIterator<T>& lhs, const SegmentedIterator<T1>& rhs) {
+		return lhs.index() == rhs.index();
+	}
+	template <class T, class T1>
+	bool operator!=(const SegmentedIterator<T>& lhs, const SegmentedIterator<T1>& rhs) {
+		return lhs.index() != rhs.index();
+	}
+	template <class T, class T1>
+	bool operator<(const SegmentedIterator<T>& lhs, const SegmentedIterator<T1>& rhs) {
+		return lhs.index() < rhs.index();
+	}
+	template <class T, class T1>
+	bool operator>(const SegmentedIterator<T>& lhs, const SegmentedIterator<T1>& rhs) {
+		return lhs.index() > rhs.index();
+	}
+	template <class T, class T1>
+	bool operator<=(const SegmentedIterator<T>& lhs, const SegmentedIterator<T1>& rhs) {
+		return lhs.index() <= rhs.index();
+	}
+	template <class T, class T1>
+	bool operator>=(const SegmentedIterator<T>& lhs, const SegmentedIterator<T1>& rhs) {
+		return lhs.index() >= rhs.index();
+	}
+	template <class T, class T1>
+	typename SegmentedIterator<T>::difference_type
+		operator-(const SegmentedIterator<T>& lhs, const SegmentedIterator<T1>& rhs) {
+		return static_cast<typename SegmentedIterator<T>::difference_type>(lhs.index() - rhs.index());
+	}
+	template <class T>
+	SegmentedIterator<T>	operator+(typename SegmentedIterator<T>::difference_type n, const SegmentedIterator<T>& x) {
+		return x + n;
+	}
+}
@@ -6,7 +6,7 @@
 /*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/12/09 00:28:24 by moabid            #+#    #+#             */
-/*   Updated: 2022/12/09 00:28:53 by moabid           ###   ########.fr       */
+/*   Updated: 2026/10/22 01:25:22 by moabid           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,14 +17,107 @@
 namespace ft
 {
 	//NODE STRUCT
-	template <typename T>
+		// count is the size of the node's subtree, so that a split knows
+		// the size of its two parts; it shares a word with the colour
+	template <typename T, bool Threaded = false>
 	struct Node
 	{
 		T			value;
 		Node*		left;
 		Node*		right;
 		Node*		parent;
-		bool		red;
+		size_t		count : sizeof(size_t) * 8 - 1;
+		size_t		red : 1;
+	};
+	// Threaded node, also linked to its in-order neighbours. The list is
+	// a ring closed by the tree's end node, so ++ and -- are one load.
+	template <typename T>
+	struct Node<T, true>
+	{
+		T			value;
+		Node*		left;
+		Node*		right;
+		Node*		parent;
+		size_t		count : sizeof(size_t) * 8 - 1;
+		size_t		red : 1;
+		Node*		next;
+		Node*		prev;
+	};
+	//IN-ORDER STEPS
+		// 1) Plain nodes climb through parent, O(log n) at worst
+	template <bool Threaded>
+	struct tree_threads {
+		template <class P>
+		static P	next(P x) {
+			if (x->right != nullptr) {
+				x = x->right;
+				while (x->left != nullptr)
+					x = x->left;
+				return x;
+			}
+			P par = x->parent;
+			while (par->parent != nullptr && x == par->right) {
+				x = par;
+				par = par->parent;
+			}
+			return par;
+		}
+		template <class P>
+		static P	prev(P x) {
+			if (x->left != nullptr) {
+				x = x->left;
+				while (x->right != nullptr)
+					x = x->right;
+				return x;
+			}
+			P par = x->parent;
+			while (par->parent != nullptr && x == par->left) {
+				x = par;
+				par = par->parent;
+			}
+			return par;
+		}
+		template <class P> static void	link(P, P) { }
+		template <class P> static void	unlink(P) { }
+		template <class P> static void	insert_leaf(P) { }
+		template <class P> static void	chain(P, P) { }
+	};
+		// 2) Threaded nodes follow their links
+	template <>
+	struct tree_threads<true> {
+		template <class P> static P	next(P x) { return x->next; }
+		template <class P> static P	prev(P x) { return x->prev; }
+			// a before b
+		template <class P> static void	link(P a, P b) {
+			a->next = b;
+			b->prev = a;
+		}
+		template <class P> static void	unlink(P x) {
+			link(x->prev, x->next);
+		}
+			// x was just linked as a leaf, its neighbours come from its parent
+		template <class P> static void	insert_leaf(P x) {
+			P	parent = x->parent;
+
+			if (x == parent->left) {
+				link(parent->prev, x);
+				link(x, parent);
+			}
+			else {
+				link(x, parent->next);
+				link(parent, x);
+			}
+		}
+			// Threads a list linked through right into the ring of end
+		template <class P> static void	chain(P end, P list) {
+			P	last = end;
+
+			for ( ; list != nullptr; list = list->right) {
+				link(last, list);
+				last = list;
+			}
+			link(last, end);
+		}
 	};
 	//MAP ITERATORS
 	template <class T, class TNode, class Tree>
@@ -60,18 +153,7 @@ namespace ft
 		}
 		// Pre-increment iterator position
 		TreeIterator&	operator++() {
-			if (_ptr->right != nullptr) {
-				_ptr = _ptr->right;
-				while (_ptr->left != nullptr)
-					_ptr = _ptr->left;
-				return *this;
-			}
-			node_type par = _ptr->parent;
-			while (par->parent != nullptr && _ptr == par->right) {
-				_ptr = par;
-				par = par->parent;
-			}
-			_ptr = par;
+			_ptr = tree_threads<Tree::threaded>::next(_ptr);
 			return *this;
 		}
 		// Post-increment iterator position
@@ -96,18 +178,7 @@ namespace ft
 		}
 		// Pre-decrement iterator position
 		TreeIterator&	operator--() {
-			if (_ptr->left != nullptr) {
-				_ptr = _ptr->left;
-				while (_ptr->right != nullptr)
-					_ptr = _ptr->right;
-				return *this;
-			}
-			node_type par = _ptr->parent;
-			while (par->parent != nullptr && _ptr == par->left) {
-				_ptr = par;
-				par = par->parent;
-			}
-			_ptr = par;
+			_ptr = tree_threads<Tree::threaded>::prev(_ptr);
 			return *this;
 		}
 		// Post-decrement iterator position
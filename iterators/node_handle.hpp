@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   node_handle.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 03:38:30 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/20 12:10:42 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+# include "TreeIterator.hpp"
+# include "../utility.hpp"
+
+namespace ft
+{
+	template <class Key, class T, class Compare, class Allocator, bool Threaded>
+	class map;
+
+	//MAP NODE HANDLE
+		// Owns a node taken out of a map by extract(). The node keeps its
+		// value and memory until it is inserted into a map again or the
+		// handle is destroyed. Move-only.
+	template <class Key, class T, class Allocator, bool Threaded = false>
+	class map_node_handle {
+	public:
+		typedef Key																key_type;
+		typedef T																mapped_type;
+		typedef Allocator														allocator_type;
+		typedef Node<ft::pair<const Key, T>, Threaded>							node;
+		typedef typename Allocator::template rebind<node>::other				node_allocator;
+
+	// CONSTRUCTORS
+		// 1) Empty
+		map_node_handle() : _node(nullptr), _alloc() { }
+		// 2) Owning
+		map_node_handle(node* n, const allocator_type& alloc) : _node(n), _alloc(alloc) { }
+		// 3) Move
+		map_node_handle(map_node_handle&& x) : _node(x._node), _alloc(x._alloc) {
+			x._node = nullptr;
+		}
+	// ASSIGN OPERATOR
+		map_node_handle& operator=(map_node_handle&& x) {
+			if (this != &x) {
+				_release();
+				_node = x._node;
+				_alloc = x._alloc;
+				x._node = nullptr;
+			}
+			return *this;
+		}
+	// DESTRUCTOR
+		~map_node_handle() {
+			_release();
+		}
+	// MEMBER FUNCTIONS
+		bool				empty() const				{ return _node == nullptr; }
+		explicit			operator bool() const		{ return _node != nullptr; }
+		allocator_type		get_allocator() const		{ return _alloc; }
+		// The key may be changed before the node is inserted again
+		key_type&			key() const					{ return const_cast<key_type&>(_node->value.first); }
+		mapped_type&		mapped() const				{ return _node->value.second; }
+		void				swap(map_node_handle& x) {
+			node*			n = _node;
+			allocator_type	alloc = _alloc;
+
+			_node = x._node;
+			_alloc = x._alloc;
+			x._node = n;
+			x._alloc = alloc;
+		}
+	private:
+		template <class, class, class, class, bool>
+		friend class map;
+
+		map_node_handle(const map_node_handle&);
+		map_node_handle& operator=(const map_node_handle&);
+
+		node*	_take() {
+			node*	n = _node;
+
+			_node = nullptr;
+			return n;
+		}
+		void	_release() {
+			if (_node == nullptr)
+				return ;
+			_alloc.destroy(&(_node->value));
+			node_allocator(_alloc).deallocate(_node, 1);
+			_node = nullptr;
+		}
+
+		node*			_node;
+		allocator_type	_alloc;
+	};
+
+	template <class Key, class T, class Allocator, bool Threaded>
+	void	swap(map_node_handle<Key, T, Allocator, Threaded>& x, map_node_handle<Key, T, Allocator, Threaded>& y) {
+		x.swap(y);
+	}
+
+	//INSERT RETURN TYPE
+		// Result of inserting a node handle: on a key collision the node
+		// comes back in node and position is the element holding the key
+	template <class Iterator, class NodeHandle>
+	struct node_insert_return {
+		Iterator	position;
+		bool		inserted;
+		NodeHandle	node;
+	};
+}
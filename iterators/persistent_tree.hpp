@@ -0,0 +1,397 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   persistent_tree.hpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:49:02 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/19 19:35:14 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+# include "../utility.hpp"
+# include "PersistentTreeIterator.hpp"
+# include "../algorithm.hpp"
+
+namespace ft
+{
+	//PERSISTENT TREE IMPLEMENTATION
+		// Red-black tree with path copying: an update copies only the nodes on the
+		// path from the root to the modified node and shares every other subtree
+		// with the previous version, so taking a snapshot is a reference count
+		// increment. Nodes that are not shared (refs == 1) are updated in place,
+		// so a tree without outstanding snapshots does not pay for copies.
+		// Rebalancing follows Kahrs' functional insertion and deletion.
+		// Reference counts are atomic: snapshots may be released from other threads.
+	template<class T, class Compare, class Allocator>
+	class persistent_tree {
+	public:
+		typedef T																	value_type;
+		typedef PNode<value_type>													node_type;
+		typedef node_type*															pointer;
+		typedef Compare																value_compare;
+		typedef Allocator															allocator_type;
+		typedef typename Allocator::template rebind<node_type>::other				node_allocator;
+		typedef typename allocator_type::size_type									size_type;
+		typedef typename ft::PersistentTreeIterator<value_type, node_type> 		iterator;
+		typedef iterator															const_iterator;
+		typedef typename ft::reverse_iterator<iterator>								reverse_iterator;
+		typedef reverse_iterator													const_reverse_iterator;
+		typedef typename std::ptrdiff_t												difference_type;
+
+	protected:
+		allocator_type			_alloc;
+		node_allocator			_node_alloc;
+		value_compare			_compare;
+		pointer					_head;
+		size_type				_size;
+
+	public:
+		//  CONSTRUCTORS AND DESTRUCTOR
+		persistent_tree(const value_compare& compare = value_compare(), const allocator_type& alloc = allocator_type())
+			: _alloc(alloc), _node_alloc(alloc), _compare(compare), _head(nullptr), _size(0) { }
+			// Copying is a snapshot: O(1), the two trees share every node
+		persistent_tree(const persistent_tree& x) : _alloc(x._alloc), _node_alloc(x._node_alloc), _compare(x._compare),
+								_head(_retain(x._head)), _size(x._size) { }
+		~persistent_tree() { _release(_head); }
+		persistent_tree& operator= (const persistent_tree& x) {
+			if (this != &x) {
+				pointer old = _head;
+				_alloc = x._alloc;
+				_node_alloc = x._node_alloc;
+				_compare = x._compare;
+				_head = _retain(x._head);
+				_size = x._size;
+				_release(old);
+			}
+			return *this;
+		}
+
+		size_type	max_size () const { return _node_alloc.max_size(); }
+		size_type	size () const { return _size; }
+		bool		empty () const { return _size == 0; }
+		// 1) Insertion of single element, does nothing if the key is present
+		bool	insert(const value_type& val) {
+			if (find(val) != nullptr)
+				return false;
+			_head = _ins(_head, val, false);
+			_head->red = false;
+			_size++;
+			return true;
+		}
+		// 2) Insertion or replacement of the element with an equivalent key
+		bool	assign(const value_type& val) {
+			bool	inserted = find(val) == nullptr;
+
+			_head = _ins(_head, val, true);
+			_head->red = false;
+			if (inserted)
+				_size++;
+			return inserted;
+		}
+		// 3) Deletion
+		size_type erase (const value_type& k) {
+			if (find(k) == nullptr)
+				return 0;
+			_head = _del(_head, k);
+			if (_head != nullptr)
+				_head->red = false;
+			_size--;
+			return 1;
+		}
+		void	clear() {
+			_release(_head);
+			_head = nullptr;
+			_size = 0;
+		}
+		// 4) Swap
+		void swap (persistent_tree& x) {
+			ft::swap(_head, x._head);
+			ft::swap(_node_alloc, x._node_alloc);
+			ft::swap(_alloc, x._alloc);
+			ft::swap(_compare, x._compare);
+			ft::swap(_size, x._size);
+		}
+		// 5) Lookup
+		const node_type*	find(const value_type& key) const {
+			for (const node_type* tmp = _head; tmp != nullptr; ) {
+				if (_compare(key, tmp->value))
+					tmp = tmp->left;
+				else if (_compare(tmp->value, key))
+					tmp = tmp->right;
+				else
+					return tmp;
+			}
+			return nullptr;
+		}
+		iterator	iter_find(const value_type& key) const {
+			iterator it = lower_bound(key);
+			if (it != end() && _compare(key, *it))
+				return end();
+			return it;
+		}
+		size_type count (const value_type& k) const {
+			if (find(k) == nullptr)
+				return 0;
+			return 1;
+		}
+		// 6) Iterators
+		iterator begin () const {
+			iterator it(_head);
+			it.leftmost(_head);
+			return it;
+		}
+		iterator end () const { return iterator(_head); }
+		// 7) lower/upper bound, the path is kept up to the last node where the
+		//    search turned left, which is the answer
+		iterator lower_bound (const value_type& k) const {
+			return _bound(k, false);
+		}
+		iterator upper_bound (const value_type& k) const {
+			return _bound(k, true);
+		}
+	private:
+		iterator	_bound(const value_type& k, bool upper) const {
+			iterator	it(_head);
+			size_type	keep = 0;
+
+			for (const node_type* tmp = _head; tmp != nullptr; ) {
+				it.push(tmp);
+				if (upper ? _compare(k, tmp->value) : !_compare(tmp->value, k)) {
+					keep = it.depth();
+					tmp = tmp->left;
+				}
+				else
+					tmp = tmp->right;
+			}
+			it.truncate(keep);
+			return it;
+		}
+		// REFERENCE COUNTING
+		static bool	_is_red(const node_type* x) { return x != nullptr && x->red; }
+		static pointer	_retain(pointer x) {
+			if (x != nullptr)
+				__atomic_add_fetch(&x->refs, 1, __ATOMIC_RELAXED);
+			return x;
+		}
+		void	_release(pointer x) {
+			while (x != nullptr && __atomic_sub_fetch(&x->refs, 1, __ATOMIC_ACQ_REL) == 0) {
+				pointer right = x->right;
+				_release(x->left);
+				_del_node(x);
+				x = right;
+			}
+		}
+			// Returns a node that can be written: x itself if nobody else sees it,
+			// a copy sharing x's children otherwise. Consumes the reference to x.
+		pointer	_own(pointer x) {
+			if (__atomic_load_n(&x->refs, __ATOMIC_ACQUIRE) == 1)
+				return x;
+			pointer copy = _nallocate(x->value);
+			copy->red = x->red;
+			copy->left = _retain(x->left);
+			copy->right = _retain(x->right);
+			_release(x);
+			return copy;
+		}
+		static pointer	_set(pointer x, bool red, pointer left, pointer right) {
+			x->red = red; x->left = left; x->right = right;
+			return x;
+		}
+		// UTILS
+			// 1) Node Allocation
+		pointer	_nallocate (const value_type& val) {
+			pointer new_node = _node_alloc.allocate(1);
+			try	{
+				_alloc.construct(&(new_node->value), val);
+			}
+			catch(...) {
+				_node_alloc.deallocate(new_node, 1);
+				throw;
+			}
+			new_node->red = true; new_node->left = nullptr;
+			new_node->right = nullptr; new_node->refs = 1;
+			return new_node;
+		}
+			// 2) Deallocate Node
+		void	_del_node (pointer pos) {
+			_alloc.destroy(&(pos->value));
+			_node_alloc.deallocate(pos, 1);
+		}
+		// INSERTION
+		pointer	_ins(pointer x, const value_type& val, bool replace) {
+			if (x == nullptr)
+				return _nallocate(val);
+			x = _own(x);
+			if (_compare(val, x->value)) {
+				if (!x->red)
+					return _balance(_ins(x->left, val, replace), x, x->right);
+				x->left = _ins(x->left, val, replace);
+			}
+			else if (_compare(x->value, val)) {
+				if (!x->red)
+					return _balance(x->left, x, _ins(x->right, val, replace));
+				x->right = _ins(x->right, val, replace);
+			}
+			else if (replace) {
+				_alloc.destroy(&(x->value));
+				_alloc.construct(&(x->value), val);
+			}
+			return x;
+		}
+		// BALANCING, y is writable and becomes the parent of l and r
+		pointer	_balance(pointer l, pointer y, pointer r) {
+			if (_is_red(l) && _is_red(r)) {
+				l = _own(l);
+				r = _own(r);
+				l->red = false;
+				r->red = false;
+				return _set(y, true, l, r);
+			}
+			if (_is_red(l)) {
+				if (_is_red(l->left)) {
+					l = _own(l);
+					pointer x = _own(l->left);
+					_set(x, false, x->left, x->right);
+					_set(y, false, l->right, r);
+					return _set(l, true, x, y);
+				}
+				if (_is_red(l->right)) {
+					l = _own(l);
+					pointer m = _own(l->right);
+					pointer b = m->left;
+					_set(y, false, m->right, r);
+					_set(l, false, l->left, b);
+					return _set(m, true, l, y);
+				}
+			}
+			if (_is_red(r)) {
+				if (_is_red(r->right)) {
+					r = _own(r);
+					pointer z = _own(r->right);
+					_set(z, false, z->left, z->right);
+					_set(y, false, l, r->left);
+					return _set(r, true, y, z);
+				}
+				if (_is_red(r->left)) {
+					r = _own(r);
+					pointer m = _own(r->left);
+					pointer c = m->right;
+					_set(y, false, l, m->left);
+					_set(r, false, c, r->right);
+					return _set(m, true, y, r);
+				}
+			}
+			return _set(y, false, l, r);
+		}
+			// Turns a black node red, lowering the black height of the subtree
+		pointer	_sub1(pointer x) {
+			x = _own(x);
+			x->red = true;
+			return x;
+		}
+			// The left subtree lost one black level
+		pointer	_balleft(pointer l, pointer x, pointer r) {
+			if (_is_red(l)) {
+				l = _own(l);
+				l->red = false;
+				return _set(x, true, l, r);
+			}
+			if (!r->red)
+				return _balance(l, x, _sub1(r));
+			r = _own(r);
+			pointer m = _own(r->left);
+			pointer a = m->left;
+			pointer b = m->right;
+			_set(x, false, l, a);
+			return _set(m, true, x, _balance(b, r, _sub1(r->right)));
+		}
+			// The right subtree lost one black level
+		pointer	_balright(pointer l, pointer x, pointer r) {
+			if (_is_red(r)) {
+				r = _own(r);
+				r->red = false;
+				return _set(x, true, l, r);
+			}
+			if (!l->red)
+				return _balance(_sub1(l), x, r);
+			l = _own(l);
+			pointer m = _own(l->right);
+			pointer b = m->left;
+			pointer c = m->right;
+			_set(x, false, c, r);
+			return _set(m, true, _balance(_sub1(l->left), l, b), x);
+		}
+		// DELETION
+			// Fuses the two subtrees of a removed node
+		pointer	_app(pointer a, pointer b) {
+			if (a == nullptr)
+				return b;
+			if (b == nullptr)
+				return a;
+			if (a->red && b->red) {
+				a = _own(a);
+				b = _own(b);
+				pointer bc = _app(a->right, b->left);
+				if (_is_red(bc)) {
+					bc = _own(bc);
+					_set(a, true, a->left, bc->left);
+					_set(b, true, bc->right, b->right);
+					return _set(bc, true, a, b);
+				}
+				_set(b, true, bc, b->right);
+				return _set(a, true, a->left, b);
+			}
+			if (!a->red && !b->red) {
+				a = _own(a);
+				b = _own(b);
+				pointer bc = _app(a->right, b->left);
+				if (_is_red(bc)) {
+					bc = _own(bc);
+					_set(a, false, a->left, bc->left);
+					_set(b, false, bc->right, b->right);
+					return _set(bc, true, a, b);
+				}
+				_set(b, false, bc, b->right);
+				return _balleft(a->left, a, b);
+			}
+			if (b->red) {
+				b = _own(b);
+				b->left = _app(a, b->left);
+				return b;
+			}
+			a = _own(a);
+			a->right = _app(a->right, b);
+			return a;
+		}
+			// k is known to be in the subtree x
+		pointer	_del(pointer x, const value_type& k) {
+			x = _own(x);
+			if (_compare(k, x->value)) {
+				if (x->left != nullptr && !x->left->red)
+					return _balleft(_del(x->left, k), x, x->right);
+				x->left = _del(x->left, k);
+				x->red = true;
+				return x;
+			}
+			if (_compare(x->value, k)) {
+				if (x->right != nullptr && !x->right->red)
+					return _balright(x->left, x, _del(x->right, k));
+				x->right = _del(x->right, k);
+				x->red = true;
+				return x;
+			}
+			pointer fused = _app(x->left, x->right);
+			_del_node(x);
+			return fused;
+		}
+	};
+
+	template<class T, class Compare, class Allocator>
+	void	swap(persistent_tree<T, Compare, Allocator>& x, persistent_tree<T, Compare, Allocator>& y) {
+		x.swap(y);
+	}
+}
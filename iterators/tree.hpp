@@ -6,24 +6,33 @@
 /*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/12/09 00:27:47 by moabid            #+#    #+#             */
-/*   Updated: 2022/12/09 18:00:59 by moabid           ###   ########.fr       */
+/*   Updated: 2026/10/22 10:33:18 by moabid           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #pragma once
 
+# include <stdexcept>
 # include "../utility.hpp"
 # include "TreeIterator.hpp"
+# include "tree_stats.hpp"
 # include "../algorithm.hpp"
+# include "../vector.hpp"
 
 namespace ft
 {
 	//TREE IMPLEMENTATION
-	template<class T, class Compare, class Allocator>
+	// Threaded trees also keep their nodes in an in-order ring (see Node),
+	// for O(1) iterator steps at the cost of two pointers per node.
+	// With FT_TREE_STATS defined, the tree counts its own work (see
+	// tree_stats.hpp): comparator calls, rotations and recolourings of
+	// insert and erase, node allocations and the depth of each descent.
+	template<class T, class Compare, class Allocator, bool Threaded = false>
 	class tree {
 	public:
+		static const bool															threaded = Threaded;
 		typedef T																	value_type;
-		typedef Node<value_type>													node_type;
+		typedef Node<value_type, Threaded>											node_type;
 		typedef node_type*															pointer;
 		typedef Compare																value_compare;
 		typedef Allocator															allocator_type;
@@ -38,19 +47,28 @@ namespace ft
 	protected:
 		allocator_type			_alloc;
 		node_allocator			_node_alloc;
+# ifdef FT_TREE_STATS
+		counted_compare<value_compare>	_compare;
+		mutable tree_stats		_stats;
+# else
 		value_compare			_compare;
+# endif
 		pointer					_root;
 		pointer					_head;
 		pointer					_nil;
 		size_type				_size;
+		typedef tree_threads<Threaded>	_threads;
 	
 	public:
 		//  CONSTRUCTORS AND DESTRUCTOR
 		tree(const value_compare& compare = value_compare(), const allocator_type& alloc = allocator_type())
 			: _alloc(alloc), _node_alloc(alloc), _compare(compare), _root(_null_leaf_alloc()),
-				_head(nullptr), _nil(_null_leaf_alloc()), _size(0) { }
+				_head(nullptr), _nil(_null_leaf_alloc()), _size(0) {
+			_threads::link(_root, _root);
+		}
 		tree (const tree& x) :	_alloc(x._alloc), _node_alloc(x._node_alloc), _compare(x._compare),
 								_root(_null_leaf_alloc()), _head(nullptr), _nil(_null_leaf_alloc()), _size(0) {
+			_threads::link(_root, _root);
 			_copy_tree(x._head);
 			_root->left = _head;
 		}
@@ -59,10 +77,10 @@ namespace ft
 			_node_alloc.deallocate(_root, 1);
 			_node_alloc.deallocate(_nil, 1);
 		}
+		// Keeps the allocators of *this: its nodes, _root and _nil
+		// included, must go back to the allocator that made them
 		tree& operator= (const tree& x) {
 			if (this != &x) {
-				_alloc = x._alloc;
-				_node_alloc = x._node_alloc;
 				_compare = x._compare;
 				clear();
 				_copy_tree(x._head);
@@ -75,15 +93,18 @@ namespace ft
 		size_type	size () const { return _size; }
 		// 1)Insertion of single element
 		ft::pair<iterator, bool> insert(const value_type& val) {
+			FT_TREE_STAT(tree_descent probe(_stats);)
 			if (_head == nullptr) {
 				_head = _nallocate(val);
 				_head->red = false;
 				_head->parent = _root;
 				_root->left = _head;
+				_threads::insert_leaf(_head);
 				_size++;
 				return ft::make_pair(iterator(_head), true);
 			}
 			for ( pointer tmp = _head; tmp != nullptr; ) {
+				FT_TREE_STAT(probe.step();)
 				if (!_compare(tmp->value, val)) {
 					if (!_compare(val, tmp->value))
 						return ft::make_pair(iterator(tmp), false);
@@ -91,6 +112,8 @@ namespace ft
 						tmp->left = _nallocate(val);
 						tmp->left->parent = tmp;
 						tmp = tmp->left;
+						_threads::insert_leaf(tmp);
+						_grow_path(tmp->parent);
 						_ins_balance(tmp);
 						_size++;
 						return ft::make_pair(iterator(tmp), true);
@@ -102,6 +125,8 @@ namespace ft
 						tmp->right = _nallocate(val);
 						tmp->right->parent = tmp;
 						tmp = tmp->right;
+						_threads::insert_leaf(tmp);
+						_grow_path(tmp->parent);
 						_ins_balance(tmp);
 						_size++;
 						return ft::make_pair(iterator(tmp), true);
@@ -125,13 +150,15 @@ namespace ft
 		const_iterator end () const { return const_iterator(_root);	}
 		// Checks if tree is empty
 		bool empty () const {
-			if (_size == 0)
+			if (_head == nullptr)
 				return true;
 			return false;
 		}
 		// 2) Find
 		pointer find(const value_type& key) const {
+			FT_TREE_STAT(tree_descent probe(_stats);)
 			for ( pointer tmp = _head; tmp != nullptr; ) {
+				FT_TREE_STAT(probe.step();)
 				if (!_compare(tmp->value, key)) {
 					if (!_compare(key, tmp->value))
 						return tmp;
@@ -150,7 +177,9 @@ namespace ft
 		}
 			// for iterator
 		pointer iter_find(const value_type& key) const {
+			FT_TREE_STAT(tree_descent probe(_stats);)
 			for ( pointer tmp = _head; tmp != nullptr; ) {
+				FT_TREE_STAT(probe.step();)
 				if (!_compare(tmp->value, key)) {
 					if (!_compare(key, tmp->value))
 						return tmp;
@@ -171,7 +200,8 @@ namespace ft
 		void	erase (pointer pos) {
 			if (pos == nullptr || pos == _root)
 				return ;
-			if (_size == 1 && pos == _head) {
+			if (pos == _head && pos->left == nullptr && pos->right == nullptr) {
+				_threads::unlink(pos);
 				_del_node(pos);
 				_head = nullptr;
 				_root->left = nullptr;
@@ -189,6 +219,9 @@ namespace ft
 		void	clear() {
 			_clear(_head);
 			_head = nullptr;
+			_root->left = nullptr;
+			_threads::link(_root, _root);
+			_size = 0;
 		}
 		void	_clear(pointer head) {
 			if (head == nullptr)
@@ -197,9 +230,10 @@ namespace ft
 			_clear(head->right);
 			_del_node(head);
 		}
-		// 4) Swap
+		// 4) Swap, every node travels with the allocator that made it
 		void swap (tree& x) {
 			ft::swap(_root, x._root);
+			ft::swap(_nil, x._nil);
 			ft::swap(_head, x._head);
 			ft::swap(_node_alloc, x._node_alloc);
 			ft::swap(_alloc, x._alloc);
@@ -212,42 +246,12 @@ namespace ft
 				return 0;
 			return 1;
 		}
-		// 6) lower/upper bound
-		iterator lower_bound (const value_type& k) {
-			iterator it = begin();
-			iterator last = end();
-			while (it != last && _compare(*it, k))
-				it++;
-			return it;
-		}
-		const_iterator lower_bound (const value_type& k) const {
-			const_iterator it = begin();
-			const_iterator last = end();
-			while (it != last && _compare(*it, k))
-				it++;
-			return it;
-		}
+		// 6) lower/upper bound, one descent from the root
+		iterator lower_bound (const value_type& k) { return iterator(_bound(k, false)); }
+		const_iterator lower_bound (const value_type& k) const { return const_iterator(_bound(k, false)); }
 		// 5) Return iterator to upper bound
-		iterator upper_bound (const value_type& k) {
-			iterator it = end();
-			iterator first = begin();
-			for (iterator tmp = it; it != first; it--) {
-				tmp--;
-				if (!_compare(k, *tmp))
-					return it;
-			}
-			return it;
-		}
-		const_iterator upper_bound (const value_type& k) const {
-			const_iterator it = end();
-			const_iterator first = begin();
-			for (const_iterator tmp = it; it != first; it--) {
-				tmp--;
-				if (!_compare(k, *tmp))
-					return it;
-			}
-			return it;
-		}
+		iterator upper_bound (const value_type& k) { return iterator(_bound(k, true)); }
+		const_iterator upper_bound (const value_type& k) const { return const_iterator(_bound(k, true)); }
 		// Min/Max search functions
 		pointer	node_maximum (pointer current) const {
 			if (current == nullptr)
@@ -264,25 +268,517 @@ namespace ft
 			return current;	
 		}
 		// Predecessor/successor functions
-		pointer	successor (pointer current) const {
-			if (current->right != nullptr)
-				return node_minimum(current->right);
-			pointer	Par = current->parent;
-			while (Par != _root && current == Par->right) {
-				current = Par;
-				Par = Par->parent;
-			}
-			return Par;
-		}
-		pointer	predecessor (pointer current) const {
-			if (current->left != nullptr)
-				return node_maximum(current->left);
-			pointer	Par = current->parent;
-			while (Par != _root && current == Par->left) {
-				current = Par;
-				Par = Par->parent;
-			}
-			return Par;
+		pointer	successor (pointer current) const { return _threads::next(current); }
+		pointer	predecessor (pointer current) const { return _threads::prev(current); }
+		// 7) Set algebra. Nodes are moved, never copied, and the nodes of
+		// *this that survive keep their iterators valid. Union and
+		// intersection split one tree by the root of the other and join the
+		// halves back (see _union), O(m log(n / m + 1)) for sizes m <= n;
+		// a union with a small enough x links its nodes one by one instead
+		// (see _prefer_lookup). Threaded trees, whose ring the joins would
+		// break, and difference walk both sides in order and rebuild the
+		// result balanced in O(m + n), or use lookups when one side is small.
+		// Union needs equal allocators, see _same_allocator.
+			// Default conflict resolution, keeps the value of *this
+		struct keep_first {
+			void operator()(value_type&, const value_type&) const { }
+		};
+			// a) Union: every node of x is moved into *this, x ends up empty.
+			// resolve(mine, theirs) is called for keys present in both.
+		template <class Resolve>
+		void	set_union(tree& x, Resolve resolve) {
+			if (this == &x)
+				return ;
+			_same_allocator(x);
+			if (x._head == nullptr)
+				return ;
+			if (_prefer_lookup(x.size(), size())) {
+				pointer	list = _to_list(x._head);
+
+				x._detach_all();
+				while (list != nullptr) {
+					pointer	next = list->right;
+					pointer	found = _link_node(list);
+
+					if (found != list) {
+						resolve(found->value, list->value);
+						_free_node(list);
+					}
+					list = next;
+				}
+				return ;
+			}
+			if (!Threaded) {
+				size_type	total = size() + x.size();
+				size_type	dropped = 0;
+				size_type	bh;
+				pointer		a = _head;
+				pointer		b = x._head;
+				size_type	abh = _black_height(a);
+
+				x._detach_all();
+				b->parent = nullptr;
+				if (a != nullptr)
+					a->parent = nullptr;
+				_install(_union(a, abh, b, _black_height(b), resolve, bh, dropped));
+				_size = total - dropped;
+				return ;
+			}
+			pointer		list = nullptr;
+			pointer*	tail = &list;
+			pointer		a = _head ? _to_list(_head) : nullptr;
+			pointer		b = _to_list(x._head);
+			size_type	n = 0;
+
+			x._detach_all();
+			while (a != nullptr && b != nullptr) {
+				if (_compare(a->value, b->value)) {
+					*tail = a;
+					a = a->right;
+				}
+				else if (_compare(b->value, a->value)) {
+					*tail = b;
+					b = b->right;
+				}
+				else {
+					pointer	next = b->right;
+
+					resolve(a->value, b->value);
+					_free_node(b);
+					b = next;
+					continue ;
+				}
+				tail = &(*tail)->right;
+				n++;
+			}
+			*tail = a ? a : b;
+			for (pointer rest = *tail; rest != nullptr; rest = rest->right)
+				n++;
+			_rebuild(list, n);
+		}
+		void	set_union(tree& x) { set_union(x, keep_first()); }
+			// b) Intersection: keeps the nodes of *this whose key is in x,
+			// resolve(mine, theirs) is called for each of them
+		template <class Resolve>
+		void	set_intersection(const tree& x, Resolve resolve) {
+			if (this != &x && !Threaded) {
+				size_type	kept = 0;
+				size_type	bh;
+				pointer		a = _head;
+
+				if (a == nullptr)
+					return ;
+				size_type	abh = _black_height(a);
+				_detach_all();
+				a->parent = nullptr;
+				_install(_intersect(a, abh, x._head, resolve, bh, kept));
+				_size = kept;
+				return ;
+			}
+			_filter(x, true, resolve);
+		}
+		void	set_intersection(const tree& x) { set_intersection(x, keep_first()); }
+			// c) Difference: removes from *this every key present in x
+		void	set_difference(const tree& x) {
+			if (this == &x) {
+				clear();
+				return ;
+			}
+			if (x._head != nullptr && _prefer_lookup(x.size(), size())) {
+				for (const_iterator it = x.begin(); it != x.end() && _head != nullptr; ++it)
+					erase(*it);
+				return ;
+			}
+			_filter(x, false, keep_first());
+		}
+		// 8) Split and join in O(log n), relinking nodes only. The size of
+		// each part is the count of its root. Both trees must use equal
+		// allocators, see _same_allocator.
+			// a) Moves every element not less than k into x (emptied first)
+		void	split(const value_type& k, tree& x) {
+			if (this == &x)
+				return ;
+			_same_allocator(x);
+			x.clear();
+			if (_head == nullptr)
+				return ;
+			pointer		left;
+			pointer		right;
+			size_type	left_bh;
+			size_type	right_bh;
+
+			_split(_head, _black_height(_head), k, left, left_bh, right, right_bh);
+			x._size = _subtree(right);
+			_size -= x._size;
+			_install(left);
+			x._install(right);
+			_thread_ends();
+			x._thread_ends();
+		}
+			// b) Appends x, whose elements must all be greater than those of
+			// *this, and empties it. Overlapping ranges fall back to set_union.
+		void	join(tree& x) {
+			if (this == &x)
+				return ;
+			_same_allocator(x);
+			if (x._head == nullptr)
+				return ;
+			if (_head == nullptr) {
+				_swap_nodes(x);
+				return ;
+			}
+			if (!_compare(node_maximum(_head)->value, node_minimum(x._head)->value)) {
+				set_union(x);
+				return ;
+			}
+			pointer		last = node_maximum(_head);
+			pointer		mid = node_minimum(x._head);
+			size_type	bh;
+
+			x._rb_unlink(mid);
+			_size += x._size;
+			pointer	right = x._head;
+			x._detach_all();
+			_threads::link(last, mid);
+			if (right != nullptr) {
+				_threads::link(mid, node_minimum(right));
+				right->parent = nullptr;
+			}
+			_head->parent = nullptr;
+			_install(_join(_head, _black_height(_head), mid, right, _black_height(right), bh));
+			_thread_ends();
+		}
+		// 9) Node transfer, nothing is allocated, copied or freed, so the
+		// allocators must be equal, see _same_allocator
+			// a) Unlinks pos and hands it over to the caller
+		pointer	extract(pointer pos) {
+			if (pos == nullptr || pos == _root)
+				return nullptr;
+			_rb_unlink(pos);
+			_size--;
+			pos->left = nullptr;
+			pos->right = nullptr;
+			pos->parent = nullptr;
+			return pos;
+		}
+			// b) Links a detached node, or returns the node already holding
+			// its key and leaves it detached
+		pointer	insert_node(pointer node) {
+			return _link_node(node);
+		}
+			// c) Moves the nodes of x whose key is not in *this, the others
+			// stay in x. Same strategy as set_union.
+		void	merge(tree& x) {
+			if (this == &x)
+				return ;
+			_same_allocator(x);
+			if (x._head == nullptr)
+				return ;
+			if (_prefer_lookup(x.size(), size())) {
+				for (pointer node = node_minimum(x._head); node != x._root; ) {
+					pointer	next = x.successor(node);
+
+					if (find(node->value) == nullptr)
+						_link_node(x.extract(node));
+					node = next;
+				}
+				return ;
+			}
+			pointer		list = nullptr;
+			pointer*	tail = &list;
+			pointer		left = nullptr;
+			pointer*	left_tail = &left;
+			pointer		a = _head ? _to_list(_head) : nullptr;
+			pointer		b = _to_list(x._head);
+			size_type	n = 0;
+			size_type	k = 0;
+
+			x._detach_all();
+			while (a != nullptr && b != nullptr) {
+				if (_compare(b->value, a->value)) {
+					*tail = b;
+					b = b->right;
+				}
+				else {
+					if (!_compare(a->value, b->value)) {
+						*left_tail = b;
+						left_tail = &b->right;
+						b = b->right;
+						k++;
+					}
+					*tail = a;
+					a = a->right;
+				}
+				tail = &(*tail)->right;
+				n++;
+			}
+			*tail = a ? a : b;
+			for (pointer rest = *tail; rest != nullptr; rest = rest->right)
+				n++;
+			*left_tail = nullptr;
+			_rebuild(list, n);
+			x._rebuild(left, k);
+		}
+		// 10) Builds the tree from values given in increasing order in O(n),
+		// chaining the nodes and balancing once at the end. A value not
+		// greater than the one before it is set aside and inserted once the
+		// tree is built, so any input is accepted, only sorted input is fast.
+		template <class InputIterator>
+		void	assign_sorted(InputIterator first, InputIterator last) {
+			pointer		list = nullptr;
+			pointer*	tail = &list;
+			pointer		prev = nullptr;
+			pointer		rest = nullptr;
+			size_type	n = 0;
+
+			clear();
+			try {
+				for (; first != last; ++first) {
+					pointer	node = _nallocate(*first);
+
+					if (prev == nullptr || _compare(prev->value, node->value)) {
+						*tail = node;
+						tail = &node->right;
+						prev = node;
+						n++;
+					}
+					else {
+						node->right = rest;
+						rest = node;
+					}
+				}
+			}
+			catch (...) {
+				_free_list(list);
+				_free_list(rest);
+				throw;
+			}
+			_rebuild(list, n);
+			while (rest != nullptr) {
+				pointer	next = rest->right;
+
+				if (_link_node(rest) != rest)
+					_free_node(rest);
+				rest = next;
+			}
+		}
+		// 11) Cuts [first, last) into at most k ordered ranges whose sizes
+		// differ by one at most. The subtree counts give the rank of first
+		// and last, then the element of rank first + i * n / k for each
+		// inner bound, one descent each. Appends the inner bounds to bounds
+		// in order, in O(k log n); fewer than k - 1 when the range holds
+		// fewer than k elements.
+		void	partition(pointer first, pointer last, size_type k, ft::vector<pointer>& bounds) const {
+			size_type	from;
+			size_type	n;
+			size_type	prev;
+
+			if (first == last || k < 2)
+				return ;
+			from = _rank(first);
+			n = _rank(last) - from;
+			prev = from;
+			for (size_type i = 1; i < k; i++) {
+				size_type	at = from + i * n / k;
+
+				if (at == prev)
+					continue ;
+				bounds.push_back(_select(at));
+				prev = at;
+			}
+		}
+		// 12) Statistics. shape() walks the tree in O(n); the counters of
+		// stats() exist with FT_TREE_STATS only.
+# ifdef FT_TREE_STATS
+		tree_stats	stats() const {
+			tree_stats	s = _stats;
+
+			s.comparisons = _compare.calls;
+			return s;
+		}
+		void	reset_stats() {
+			_stats.clear();
+			_compare.calls = 0;
+		}
+# endif
+		tree_shape	shape() const {
+			tree_shape									s;
+			ft::vector<ft::pair<pointer, size_type> >	stack;
+			ft::vector<size_type>						blacks;
+			size_type									leaf_bh = 0;
+
+			s.black_height = _black_height(_head);
+			if (_head != nullptr) {
+				stack.push_back(ft::make_pair(_head, size_type(1)));
+				blacks.push_back(0);
+			}
+			while (!stack.empty()) {
+				pointer		node = stack.back().first;
+				size_type	depth = stack.back().second;
+				size_type	bh = blacks.back() + !node->red;
+
+				stack.pop_back();
+				blacks.pop_back();
+				s.size++;
+				s.depth_sum += depth;
+				if (depth >= s.nodes.size())
+					s.nodes.resize(depth + 1, 0);
+				s.nodes[depth]++;
+				if (depth > s.height)
+					s.height = depth;
+				if (node->red && node->parent != _root && node->parent->red)
+					s.valid = false;
+				if (node->left == nullptr || node->right == nullptr) {
+					if (leaf_bh == 0)
+						leaf_bh = bh;
+					s.valid = s.valid && bh == leaf_bh;
+				}
+				if (node->left != nullptr) {
+					stack.push_back(ft::make_pair(node->left, depth + 1));
+					blacks.push_back(bh);
+				}
+				if (node->right != nullptr) {
+					stack.push_back(ft::make_pair(node->right, depth + 1));
+					blacks.push_back(bh);
+				}
+			}
+			return s;
+		}
+		// 13) Batched lookups: out[i] is the node holding keys[i], or
+		// nullptr. Up to find_lanes descents take turns, each prefetching
+		// the node it will compare against next, so their cache misses
+		// overlap instead of queueing; a lane whose descent ends picks up
+		// the next key straight away (asynchronous memory access chaining),
+		// so short and long descents do not hold each other up.
+		static const size_type	find_lanes = 32;
+
+		void	find_batch(const value_type* keys, size_type n, pointer* out) const {
+			pointer		node[find_lanes];
+			size_type	key[find_lanes];
+			size_type	lanes = n < find_lanes ? n : find_lanes;
+			size_type	next = lanes;
+			size_type	active = lanes;
+			FT_TREE_STAT(size_type depth[find_lanes];)
+
+			if (_head == nullptr) {
+				for (size_type i = 0; i < n; i++)
+					out[i] = nullptr;
+				return ;
+			}
+			for (size_type l = 0; l < lanes; l++) {
+				node[l] = _head;
+				key[l] = l;
+				FT_TREE_STAT(depth[l] = 0;)
+			}
+			while (active > 0) {
+				for (size_type l = 0; l < lanes; l++) {
+					pointer	x = node[l];
+
+					if (x == nullptr)
+						continue ;
+					const value_type&	k = keys[key[l]];
+
+					FT_TREE_STAT(depth[l]++;)
+					if (_compare(k, x->value))
+						x = x->left;
+					else if (_compare(x->value, k))
+						x = x->right;
+					else {
+						out[key[l]] = x;
+						x = _root;
+					}
+					if (x == nullptr)
+						out[key[l]] = nullptr;
+					if (x == nullptr || x == _root) {
+						FT_TREE_STAT(_stats.descent(depth[l]);)
+						FT_TREE_STAT(depth[l] = 0;)
+						if (next == n) {
+							node[l] = nullptr;
+							active--;
+							continue ;
+						}
+						key[l] = next++;
+						x = _head;
+					}
+					__builtin_prefetch(x);
+					node[l] = x;
+				}
+			}
+		}
+		// 14) Inserts values given in any order. They are copied into one
+		// buffer and sorted there, then linked in one ascending pass where
+		// each descent starts from the last insertion point and climbs only
+		// as far as the new key needs (finger search), or, when the batch is
+		// large next to the tree, merged with the flattened tree and rebuilt.
+		// Nodes are made in key order, for new keys only: the lookup pass
+		// searches first and allocates only on a miss. The first of equal
+		// values wins, as with insert; the new nodes are appended to
+		// inserted, in order.
+		template <class InputIterator>
+		void	insert_batch(InputIterator first, InputIterator last, ft::vector<pointer>& inserted) {
+			ft::vector<value_type>			values;
+			ft::vector<const value_type*>	order;
+			size_type						m = 0;
+
+			for ( ; first != last; ++first)
+				values.push_back(*first);
+			for (size_type i = 0; i < values.size(); i++)
+				order.push_back(&values[i]);
+			_sort_values(order);
+			for (size_type i = 0; i < order.size(); i++)
+				if (m == 0 || _compare(*order[m - 1], *order[i]))
+					order[m++] = order[i];
+			if (_head != nullptr && _prefer_lookup(m, size())) {
+				pointer	finger = nullptr;
+
+				for (size_type i = 0; i < m; i++) {
+					pointer	parent;
+					bool	left;
+					pointer	found = _find_slot(*order[i], finger ? _finger(finger, *order[i]) : _head, parent, left);
+
+					if (found == nullptr) {
+						found = _nallocate(*order[i]);
+						_attach(found, parent, left);
+						inserted.push_back(found);
+					}
+					finger = found;
+				}
+				return ;
+			}
+			pointer		list = nullptr;
+			pointer*	tail = &list;
+			pointer		a = _head ? _to_list(_head) : nullptr;
+			size_type	n = 0;
+
+			try {
+				for (size_type i = 0; i < m; ) {
+					if (a == nullptr || _compare(*order[i], a->value)) {
+						*tail = _nallocate(*order[i++]);
+						inserted.push_back(*tail);
+					}
+					else if (_compare(a->value, *order[i])) {
+						*tail = a;
+						a = a->right;
+					}
+					else {
+						i++;
+						continue ;
+					}
+					tail = &(*tail)->right;
+					n++;
+				}
+			}
+			catch (...) {
+				*tail = a;
+				for ( ; a != nullptr; a = a->right)
+					n++;
+				_rebuild(list, n);
+				throw;
+			}
+			*tail = a;
+			for ( ; a != nullptr; a = a->right)
+				n++;
+			_rebuild(list, n);
 		}
 	private:
 		//TREE MANIPULATION
@@ -291,6 +787,7 @@ namespace ft
 			pointer y = x->right;
 	
 			if (y) {
+				FT_TREE_STAT(_stats.rotations++;)
 				x->right = y->left;
 				if (y->left)
 					y->left->parent = x;
@@ -307,6 +804,8 @@ namespace ft
 					_root->left = _head;
 				}
 				x->parent = y;
+				y->count = x->count;
+				_recount(x);
 			}
 		}
 			//2)Right Rotation
@@ -314,6 +813,7 @@ namespace ft
 			pointer y = x->left;
 	
 			if (y) {
+				FT_TREE_STAT(_stats.rotations++;)
 				x->left = y->right;
 				if (y->right)
 					y->right->parent = x;
@@ -330,6 +830,8 @@ namespace ft
 					_root->left = _head;
 				}
 				x->parent = y;
+				y->count = x->count;
+				_recount(x);
 			}
 		}
 			//3)Recolour
@@ -338,27 +840,42 @@ namespace ft
 				x.red = false;
 			else
 				x.red = true;
+		}
+			//4)Colour change of the rebalancing code, counted in stats mode
+		void	_paint(pointer x, bool red) {
+			FT_TREE_STAT(_stats.recolorings += (x->red != red);)
+			x->red = red;
 		}
 		// UTILS
 			// 1) Node Allocation
 				// a) red node allocation
 		pointer	_nallocate (const value_type& val) {
 			pointer new_node = _node_alloc.allocate(1);
+			FT_TREE_STAT(_stats.allocations++;)
 			try	{
 				_alloc.construct(&(new_node->value), val);
 			}
 			catch(...) {
 				_node_alloc.deallocate(new_node, 1);
+				throw;
 			}
 			new_node->red = true; new_node->left = nullptr;
 			new_node->right = nullptr; new_node->parent = nullptr;
+			new_node->count = 1;
 			return new_node;
 		}
-				// b) Null leaf allocation
+				// b) Nodes moved in from x are freed by this tree's
+				// allocator, which must be able to free x's
+		void	_same_allocator(const tree& x) const {
+			if (!(_node_alloc == x._node_alloc))
+				throw std::invalid_argument("ft::map");
+		}
+				// c) Null leaf allocation
 		pointer	_null_leaf_alloc() {
 			pointer new_node = _node_alloc.allocate(1);
 			new_node->red = false; new_node->left = nullptr;
 			new_node->right = nullptr; new_node->parent = nullptr;
+			new_node->count = 0;
 			return new_node;
 		}
 			// 2) Deallocate Node
@@ -370,6 +887,7 @@ namespace ft
 				_node_alloc.deallocate(pos, 1);
 			}
 			_node_alloc.deallocate(pos, 1);
+			FT_TREE_STAT(_stats.deallocations++;)
 			_size--;
 		}
 			// 3) Balance Tree after Insertion
@@ -400,35 +918,42 @@ namespace ft
 					}
 				}
 			}
-			_head->red = false;
+			_paint(_head, false);
 		}
 		// 4) Balncing insertion cases
 			 // If Uncle is red colour -> colors to be flipped -> Uncle and Parent become black, Grandparent red
 		pointer	_ins_balance_case1(pointer Kid, pointer Uncle) {
-			Kid->parent->red = false;
-			Uncle->red = false;
+			_paint(Kid->parent, false);
+			_paint(Uncle, false);
 			if (Kid->parent->parent != _root)
-				Kid->parent->parent->red = true;
+				_paint(Kid->parent->parent, true);
 			return Kid->parent->parent;
 		}
 			 //b) Uncle is black, Parent is right child and kid is right child
 		void	_ins_balance_case2(pointer Kid) {
-			Kid->parent->red = false;
-			Kid->parent->parent->red = true;
+			_paint(Kid->parent, false);
+			_paint(Kid->parent->parent, true);
 			rotate_left(Kid->parent->parent);
 		}
 			 //c) Uncle is black, Parent is right child and kid is left child
 		void	_ins_balance_case3(pointer Kid) {
-			Kid->parent->red = false;
-			Kid->parent->parent->red = true;
+			_paint(Kid->parent, false);
+			_paint(Kid->parent->parent, true);
 			rotate_right(Kid->parent->parent);
 		}
 		// 5) Deleting Node from tree
 		void	_rb_deletion(pointer z) {
+			_rb_unlink(z);
+			_del_node(z);
+		}
+			// Takes z out of the tree and rebalances, z itself is untouched
+		void	_rb_unlink(pointer z) {
 			bool	is_red = z->red;
 			pointer x;
 			pointer y = z;
-	
+
+			_threads::unlink(z);
+			_shrink_path(z->left != nullptr && z->right != nullptr ? node_maximum(z->left)->parent : z->parent);
 			if (z->left == nullptr) {
 				if (z->right == nullptr && is_red == false) {
 					z->right = _nil;
@@ -450,7 +975,8 @@ namespace ft
 				}
 				x = y->left;
 				if (y->parent == z) {
-					x->parent = y;
+					if (x)
+						x->parent = y;
 				}
 				else {
 					_del_changenodes(y, y->left);
@@ -460,9 +986,9 @@ namespace ft
 				_del_changenodes(z, y);
 				y->right = z->right;
 				y->right->parent = y;
-				y->red = z->red;
-			}		
-			_del_node(z);
+				y->count = z->count;
+				_paint(y, z->red);
+			}
 			if (is_red == false)
 				_del_rebalance(x);
 			_remove_nill_leaf();
@@ -473,25 +999,25 @@ namespace ft
 				if (x == x->parent->left) {
 					s = x->parent->right;
 					if (s->red == true) {
-						s->red = false;
-						x->parent->red = true;
+						_paint(s, false);
+						_paint(x->parent, true);
 						rotate_left(x->parent);
 						s = x->parent->right;
 					}
 					if ((s->left == nullptr || s->left->red == false) && (s->right == nullptr || s->right->red == false)) {
-						s->red = true;
+						_paint(s, true);
 						x = x->parent;
 					}
 					else {
 						if (s->right == nullptr || s->right->red == false) {
-							s->left->red = false;
-							s->red = true;
+							_paint(s->left, false);
+							_paint(s, true);
 							rotate_right(s);
 							s = x->parent->right;
 						}
-						s->red = x->parent->red;
-						s->parent->red = false;
-						s->right->red = false;
+						_paint(s, x->parent->red);
+						_paint(s->parent, false);
+						_paint(s->right, false);
 						rotate_left(x->parent);
 						x = _head;
 					}
@@ -499,31 +1025,31 @@ namespace ft
 				else {
 					s = x->parent->left;
 					if (s->red == true) {
-						s->red = false;
-						x->parent->red = true;
+						_paint(s, false);
+						_paint(x->parent, true);
 						rotate_right(x->parent);
 						s = x->parent->left;
 					}
 					if ((s->left == nullptr || s->left->red == false) && (s->right == nullptr || s->right->red == false)) {
-						s->red = true;
+						_paint(s, true);
 						x = x->parent;
 					}
 					else {
 						if (s->left == nullptr || s->left->red == false) {
-							s->right->red = false;
-							s->red = true;
+							_paint(s->right, false);
+							_paint(s, true);
 							rotate_left(s);
 							s = x->parent->left;
 						}
-						s->red = x->parent->red;
-						x->parent->red = false;
-						s->left->red = false;
+						_paint(s, x->parent->red);
+						_paint(x->parent, false);
+						_paint(s->left, false);
 						rotate_right(x->parent);
 						x = _head;
 					}
 				}
 			}
-			x->red = false;
+			_paint(x, false);
 		}
 		// Replaces node 'pos' with a node 'other_pos'
 		void _del_changenodes(pointer pos, pointer other_pos) {
@@ -550,6 +1076,584 @@ namespace ft
 			if (_head == _nil)
 				_head = nullptr;
 		}
+		// SEARCH UTILS
+			// First node not less than k (upper: greater than k), or _root
+		pointer	_bound(const value_type& k, bool upper) const {
+			pointer	found = _root;
+			FT_TREE_STAT(tree_descent probe(_stats);)
+
+			for (pointer tmp = _head; tmp != nullptr; ) {
+				FT_TREE_STAT(probe.step();)
+				if (upper ? _compare(k, tmp->value) : !_compare(tmp->value, k)) {
+					found = tmp;
+					tmp = tmp->left;
+				}
+				else
+					tmp = tmp->right;
+			}
+			return found;
+		}
+			// Number of elements before x, end() included, from the counts
+			// of the left subtrees met on the way up
+		size_type	_rank(pointer x) const {
+			size_type	r;
+
+			if (x == _root)
+				return _size;
+			r = _subtree(x->left);
+			for ( ; x != _head; x = x->parent)
+				if (x == x->parent->right)
+					r += _subtree(x->parent->left) + 1;
+			return r;
+		}
+			// Element of rank i < size(), one descent from the root
+		pointer	_select(size_type i) const {
+			pointer	x = _head;
+
+			while (i != _subtree(x->left)) {
+				if (i < _subtree(x->left))
+					x = x->left;
+				else {
+					i -= _subtree(x->left) + 1;
+					x = x->right;
+				}
+			}
+			return x;
+		}
+		// SET ALGEBRA UTILS
+			// a) true when m lookups of log n steps beat walking m + n nodes.
+			// A walk touches each node about four times (flatten, merge,
+			// rebuild, parent links) against once per step for a lookup.
+		static bool	_prefer_lookup(size_type m, size_type n) {
+			size_type	log = 1;
+
+			for (size_type i = n; i > 1; i >>= 1)
+				log++;
+			return m * log < 4 * (m + n);
+		}
+			// b) Flattens a subtree into an in-order list linked through
+			// right, by right rotations (tree-to-vine), without extra memory
+		static pointer	_to_list(pointer node) {
+			pointer		list = nullptr;
+			pointer*	tail = &list;
+
+			while (node != nullptr) {
+				if (node->left != nullptr) {
+					pointer	l = node->left;
+
+					node->left = l->right;
+					l->right = node;
+					node = l;
+				}
+				else {
+					*tail = node;
+					tail = &node->right;
+					node = node->right;
+				}
+			}
+			return list;
+		}
+			// c) Empties the tree without touching its nodes
+		void	_detach_all() {
+			_head = nullptr;
+			_root->left = nullptr;
+			_threads::link(_root, _root);
+			_size = 0;
+		}
+			// d) Destroys a node that does not count in _size
+		void	_free_node(pointer node) {
+			_alloc.destroy(&(node->value));
+			_node_alloc.deallocate(node, 1);
+			FT_TREE_STAT(_stats.deallocations++;)
+		}
+			// ... or a list of them linked through right
+		void	_free_list(pointer list) {
+			while (list != nullptr) {
+				pointer	next = list->right;
+
+				_free_node(list);
+				list = next;
+			}
+		}
+			// e) Links a detached node where insert would create it,
+			// returns the node already holding its key if there is one.
+			// The search starts at from, whose subtree must span the key.
+		pointer	_link_node(pointer node) { return _link_node(node, _head); }
+		pointer	_link_node(pointer node, pointer from) {
+			pointer	parent;
+			bool	left;
+			pointer	found = _find_slot(node->value, from, parent, left);
+
+			if (found != nullptr)
+				return found;
+			_attach(node, parent, left);
+			return node;
+		}
+				// Descends from from towards val: returns the node holding
+				// its key, or nullptr with the leaf slot in parent and left
+		pointer	_find_slot(const value_type& val, pointer from, pointer& parent, bool& left) const {
+			FT_TREE_STAT(tree_descent probe(_stats);)
+
+			parent = _root;
+			left = true;
+			for (pointer tmp = from; tmp != nullptr; ) {
+				FT_TREE_STAT(probe.step();)
+				parent = tmp;
+				if (_compare(val, tmp->value)) {
+					left = true;
+					tmp = tmp->left;
+				}
+				else if (_compare(tmp->value, val)) {
+					left = false;
+					tmp = tmp->right;
+				}
+				else
+					return tmp;
+			}
+			return nullptr;
+		}
+				// Links node into the slot found by _find_slot and rebalances
+		void	_attach(pointer node, pointer parent, bool left) {
+			node->left = nullptr;
+			node->right = nullptr;
+			node->parent = parent;
+			node->red = true;
+			node->count = 1;
+			_size++;
+			if (parent == _root) {
+				_head = node;
+				_root->left = _head;
+				_head->red = false;
+				_threads::insert_leaf(node);
+				return ;
+			}
+			if (left)
+				parent->left = node;
+			else
+				parent->right = node;
+			_threads::insert_leaf(node);
+			_grow_path(parent);
+			_ins_balance(node);
+		}
+				// Lowest ancestor of x whose subtree spans val's key, for a
+				// key greater than x's: climbs until it leaves a left subtree
+				// through a parent greater than the key
+		pointer	_finger(pointer x, const value_type& val) const {
+			while (x != _head) {
+				pointer	p = x->parent;
+
+				if (x == p->left && _compare(val, p->value))
+					break ;
+				x = p;
+			}
+			return x;
+		}
+				// Stable bottom-up merge sort of pointers to values: runs of
+				// 16 by insertion, then merges between v and a buffer
+		void	_sort_values(ft::vector<const value_type*>& v) const {
+			static const size_type			run = 16;
+			size_type						n = v.size();
+			ft::vector<const value_type*>	buffer(n);
+			const value_type**				src = v.data();
+			const value_type**				dst = buffer.data();
+
+			for (size_type lo = 0; lo < n; lo += run) {
+				size_type	hi = lo + run < n ? lo + run : n;
+
+				for (size_type i = lo + 1; i < hi; i++) {
+					const value_type*	x = src[i];
+					size_type			j = i;
+
+					for ( ; j > lo && _compare(*x, *src[j - 1]); j--)
+						src[j] = src[j - 1];
+					src[j] = x;
+				}
+			}
+			for (size_type width = run; width < n; width *= 2) {
+				for (size_type lo = 0; lo < n; lo += 2 * width) {
+					size_type	mid = lo + width < n ? lo + width : n;
+					size_type	hi = mid + width < n ? mid + width : n;
+					size_type	a = lo;
+					size_type	b = mid;
+
+					for (size_type k = lo; k < hi; k++)
+						dst[k] = (b < hi && (a == mid || _compare(*src[b], *src[a]))) ? src[b++] : src[a++];
+				}
+				ft::swap(src, dst);
+			}
+			if (src != v.data())
+				for (size_type i = 0; i < n; i++)
+					v[i] = src[i];
+		}
+			// f) Turns a sorted list of n nodes into a balanced tree in O(n).
+			// Subtree sizes differ by at most one, so every leaf is on the
+			// last two levels; the nodes of an incomplete last level are red.
+		void	_rebuild(pointer list, size_type n) {
+			size_type	red_depth = 0;
+
+			for (size_type i = n + 1; i > 1; i >>= 1)
+				red_depth++;
+			_threads::chain(_root, list);
+			_head = _build(list, n, 0, red_depth);
+			_root->left = _head;
+			_size = n;
+			if (_head != nullptr) {
+				_head->parent = _root;
+				_head->red = false;
+			}
+		}
+		pointer	_build(pointer& list, size_type n, size_type depth, size_type red_depth) {
+			if (n == 0)
+				return nullptr;
+			pointer	left = _build(list, (n - 1) / 2, depth + 1, red_depth);
+			pointer	node = list;
+
+			list = list->right;
+			node->left = left;
+			if (left != nullptr)
+				left->parent = node;
+			node->right = _build(list, n - 1 - (n - 1) / 2, depth + 1, red_depth);
+			if (node->right != nullptr)
+				node->right->parent = node;
+			_recount(node);
+			node->red = (depth == red_depth);
+			return node;
+		}
+			// g) Keeps the nodes of *this whose key is (keep) or is not (!keep)
+			// in x, finding them by walking x in order or by lookups in x
+		template <class Resolve>
+		void	_filter(const tree& x, bool keep, Resolve resolve) {
+			if (this == &x) {
+				if (!keep)
+					clear();
+				return ;
+			}
+			if (_head == nullptr)
+				return ;
+			bool			lookup = _prefer_lookup(size(), x.size());
+			pointer			kept = nullptr;
+			pointer*		tail = &kept;
+			pointer			list = _to_list(_head);
+			const_iterator	it = x.begin();
+			size_type		n = 0;
+
+			_detach_all();
+			while (list != nullptr) {
+				pointer	next = list->right;
+				pointer	match = nullptr;
+
+				if (lookup)
+					match = x.find(list->value);
+				else {
+					while (it != x.end() && _compare(*it, list->value))
+						++it;
+					if (it != x.end() && !_compare(list->value, *it))
+						match = const_cast<pointer>(it.base());
+				}
+				if ((match != nullptr) == keep) {
+					if (match != nullptr)
+						resolve(list->value, match->value);
+					*tail = list;
+					tail = &list->right;
+					n++;
+				}
+				else
+					_free_node(list);
+				list = next;
+			}
+			*tail = nullptr;
+			_rebuild(kept, n);
+		}
+		// SPLIT AND JOIN UTILS
+			// a) Black nodes from node down to a leaf, node included
+		static size_type	_black_height(pointer node) {
+			size_type	bh = 0;
+
+			for ( ; node != nullptr; node = node->left)
+				if (!node->red)
+					bh++;
+			return bh;
+		}
+			// b) Makes node, whose parent is left unset, the whole tree
+		void	_install(pointer node) {
+			_head = node;
+			_root->left = node;
+			if (node != nullptr) {
+				node->parent = _root;
+				node->red = false;
+			}
+		}
+			// c) Exchanges the nodes only, allocators and comparators stay
+		void	_swap_nodes(tree& x) {
+			pointer	head = _head;
+
+			_install(x._head);
+			x._install(head);
+			ft::swap(_size, x._size);
+			_thread_ends();
+			x._thread_ends();
+		}
+			// Reconnects the first and last nodes to the ring of _root,
+			// after a split or join moved them between trees
+		void	_thread_ends() {
+			if (!Threaded)
+				return ;
+			if (_head == nullptr)
+				_threads::link(_root, _root);
+			else {
+				_threads::link(_root, node_minimum(_head));
+				_threads::link(node_maximum(_head), _root);
+			}
+		}
+			// Subtree sizes kept in the nodes: the count of a possibly
+			// empty subtree, the count of a node from its children, and the
+			// counts of the ancestors of a node added or removed below from
+		static size_type	_subtree(pointer node) { return node == nullptr ? 0 : node->count; }
+		static void	_recount(pointer node) {
+			node->count = 1 + _subtree(node->left) + _subtree(node->right);
+		}
+		void	_grow_path(pointer from) {
+			for ( ; from != _root; from = from->parent)
+				from->count++;
+		}
+		void	_shrink_path(pointer from) {
+			for ( ; from != _root; from = from->parent)
+				from->count--;
+		}
+			// d) Rotations of a detached subtree, the caller links the new top
+		static pointer	_detached_rotate_left(pointer x) {
+			pointer	y = x->right;
+
+			x->right = y->left;
+			if (y->left != nullptr)
+				y->left->parent = x;
+			y->left = x;
+			x->parent = y;
+			y->count = x->count;
+			_recount(x);
+			return y;
+		}
+		static pointer	_detached_rotate_right(pointer x) {
+			pointer	y = x->left;
+
+			x->left = y->right;
+			if (y->right != nullptr)
+				y->right->parent = x;
+			y->right = x;
+			x->parent = y;
+			y->count = x->count;
+			_recount(x);
+			return y;
+		}
+		static void	_set_children(pointer node, pointer left, pointer right) {
+			node->left = left;
+			node->right = right;
+			if (left != nullptr)
+				left->parent = node;
+			if (right != nullptr)
+				right->parent = node;
+			_recount(node);
+		}
+			// e) Joins l < mid < r into one tree with a black root and returns
+			// it with its black height. mid hangs red at the black node of the
+			// taller tree's inner spine whose height matches the shorter tree,
+			// then red-red pairs are rotated away on the way back up: the cost
+			// is the difference of black heights.
+		static pointer	_join(pointer l, size_type lbh, pointer mid, pointer r, size_type rbh, size_type& bh) {
+			pointer	top;
+
+			if (l != nullptr && l->red) {
+				l->red = false;
+				lbh++;
+			}
+			if (r != nullptr && r->red) {
+				r->red = false;
+				rbh++;
+			}
+			if (lbh > rbh)
+				top = _join_right(l, lbh, mid, r, rbh);
+			else if (rbh > lbh)
+				top = _join_left(l, lbh, mid, r, rbh);
+			else {
+				_set_children(mid, l, r);
+				top = mid;
+				top->red = true;
+			}
+			bh = (lbh > rbh ? lbh : rbh) + (top->red ? 1 : 0);
+			top->red = false;
+			top->parent = nullptr;
+			return top;
+		}
+		static pointer	_join_right(pointer l, size_type lbh, pointer mid, pointer r, size_type rbh) {
+			if (l == nullptr || (!l->red && lbh == rbh)) {
+				_set_children(mid, l, r);
+				mid->red = true;
+				return mid;
+			}
+			pointer	c = _join_right(l->right, lbh - (l->red ? 0 : 1), mid, r, rbh);
+
+			l->right = c;
+			c->parent = l;
+			_recount(l);
+			if (!l->red && c->red && c->right != nullptr && c->right->red) {
+				c->right->red = false;
+				return _detached_rotate_left(l);
+			}
+			return l;
+		}
+		static pointer	_join_left(pointer l, size_type lbh, pointer mid, pointer r, size_type rbh) {
+			if (r == nullptr || (!r->red && rbh == lbh)) {
+				_set_children(mid, l, r);
+				mid->red = true;
+				return mid;
+			}
+			pointer	c = _join_left(l, lbh, mid, r->left, rbh - (r->red ? 0 : 1));
+
+			r->left = c;
+			c->parent = r;
+			_recount(r);
+			if (!r->red && c->red && c->left != nullptr && c->left->red) {
+				c->left->red = false;
+				return _detached_rotate_right(r);
+			}
+			return r;
+		}
+			// f) Splits the subtree t of black height bh into the nodes less
+			// than k and the others, joining the pieces cut off on the way
+			// down; the joins cost O(log n) in total.
+		void	_split(pointer t, size_type bh, const value_type& k,
+						pointer& l, size_type& lbh, pointer& r, size_type& rbh) {
+			pointer	found;
+
+			_split_at(t, bh, k, l, lbh, found, r, rbh);
+			if (found != nullptr)
+				r = _join(nullptr, 0, found, r, rbh, rbh);
+		}
+			// ... with the node equal to k, if any, left out in found
+		void	_split_at(pointer t, size_type bh, const value_type& k,
+						pointer& l, size_type& lbh, pointer& found, pointer& r, size_type& rbh) {
+			if (t == nullptr) {
+				l = nullptr;
+				r = nullptr;
+				found = nullptr;
+				lbh = 0;
+				rbh = 0;
+				return ;
+			}
+			pointer		tl = t->left;
+			pointer		tr = t->right;
+			size_type	cbh = bh - (t->red ? 0 : 1);
+			pointer		piece;
+			size_type	piece_bh;
+
+			if (tl != nullptr)
+				tl->parent = nullptr;
+			if (tr != nullptr)
+				tr->parent = nullptr;
+			if (_compare(t->value, k)) {
+				_split_at(tr, cbh, k, piece, piece_bh, found, r, rbh);
+				l = _join(tl, cbh, t, piece, piece_bh, lbh);
+			}
+			else if (_compare(k, t->value)) {
+				_split_at(tl, cbh, k, l, lbh, found, piece, piece_bh);
+				r = _join(piece, piece_bh, t, tr, cbh, rbh);
+			}
+			else {
+				found = t;
+				l = tl;
+				lbh = cbh;
+				r = tr;
+				rbh = cbh;
+			}
+		}
+			// g) Joins l < r without a middle node: the minimum of r is cut
+			// out by a split and used as one
+		pointer	_join2(pointer l, size_type lbh, pointer r, size_type rbh, size_type& bh) {
+			pointer		empty;
+			pointer		mid;
+			size_type	empty_bh;
+
+			if (r == nullptr) {
+				bh = lbh;
+				return l;
+			}
+			if (l == nullptr) {
+				bh = rbh;
+				return r;
+			}
+			_split_at(r, rbh, node_minimum(r)->value, empty, empty_bh, mid, r, rbh);
+			return _join(l, lbh, mid, r, rbh, bh);
+		}
+			// h) Join-based union of the detached trees a and b: a is split
+			// by the root of b, the halves are united with the children of b
+			// and joined again around it, O(m log(n / m + 1)) for m = |b|.
+			// A node of b whose key is in a is freed, dropped counts them.
+		template <class Resolve>
+		pointer	_union(pointer a, size_type abh, pointer b, size_type bbh,
+						Resolve& resolve, size_type& bh, size_type& dropped) {
+			if (b == nullptr) {
+				bh = abh;
+				return a;
+			}
+			if (a == nullptr) {
+				bh = bbh;
+				return b;
+			}
+			pointer		bl = b->left;
+			pointer		br = b->right;
+			size_type	cbh = bbh - (b->red ? 0 : 1);
+			pointer		l;
+			pointer		r;
+			pointer		mid = b;
+			size_type	lbh;
+			size_type	rbh;
+
+			if (bl != nullptr)
+				bl->parent = nullptr;
+			if (br != nullptr)
+				br->parent = nullptr;
+			_split_at(a, abh, b->value, l, lbh, mid, r, rbh);
+			if (mid != nullptr) {
+				resolve(mid->value, b->value);
+				_free_node(b);
+				dropped++;
+			}
+			else
+				mid = b;
+			l = _union(l, lbh, bl, cbh, resolve, lbh, dropped);
+			r = _union(r, rbh, br, cbh, resolve, rbh, dropped);
+			return _join(l, lbh, mid, r, rbh, bh);
+		}
+			// i) Keeps the nodes of the detached tree a whose key is in the
+			// subtree x of another tree, the same way; the others are freed
+			// and kept counts the survivors
+		template <class Resolve>
+		pointer	_intersect(pointer a, size_type abh, const node_type* x,
+						Resolve& resolve, size_type& bh, size_type& kept) {
+			if (a == nullptr) {
+				bh = 0;
+				return nullptr;
+			}
+			if (x == nullptr) {
+				_free_list(_to_list(a));
+				bh = 0;
+				return nullptr;
+			}
+			pointer		l;
+			pointer		r;
+			pointer		mid;
+			size_type	lbh;
+			size_type	rbh;
+
+			_split_at(a, abh, x->value, l, lbh, mid, r, rbh);
+			l = _intersect(l, lbh, x->left, resolve, lbh, kept);
+			r = _intersect(r, rbh, x->right, resolve, rbh, kept);
+			if (mid == nullptr)
+				return _join2(l, lbh, r, rbh, bh);
+			resolve(mid->value, x->value);
+			kept++;
+			return _join(l, lbh, mid, r, rbh, bh);
+		}
 		void	_copy_tree(pointer other_head) {
 			if (other_head == nullptr)
 				return ;
@@ -558,4 +1662,9 @@ namespace ft
 			_copy_tree(other_head->right);
 		}
 	};
+
+	template<class T, class Compare, class Allocator, bool Threaded>
+	void	swap(tree<T, Compare, Allocator, Threaded>& x, tree<T, Compare, Allocator, Threaded>& y) {
+		x.swap(y);
+	}
 }
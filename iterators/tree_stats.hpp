@@ -0,0 +1,134 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tree_stats.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 19:16:01 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/20 19:16:01 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+# include <stddef.h>
+# include <ostream>
+# include "../vector.hpp"
+
+// Operation counters of ft::tree, compiled in with FT_TREE_STATS defined.
+// The macro changes the layout of every tree, so it must be set for the
+// whole program; without it the counting code is not even compiled.
+# ifdef FT_TREE_STATS
+#  define FT_TREE_STAT(statement) statement
+# else
+#  define FT_TREE_STAT(statement)
+# endif
+
+namespace ft
+{
+	//TREE STATISTICS
+		// Counts since construction or the last reset_stats(). A descent is
+		// one root-to-node search (insert, find, bounds, node links), its
+		// depth the number of nodes it compared against.
+	struct tree_stats
+	{
+		static const size_t	max_depth = 128;
+
+		size_t	comparisons;
+		size_t	rotations;
+		size_t	recolorings;
+		size_t	allocations;
+		size_t	deallocations;
+		size_t	descents;
+		size_t	depth_sum;
+		size_t	depth_max;
+		size_t	depth[max_depth + 1];
+
+		tree_stats() { clear(); }
+
+		void	clear() {
+			comparisons = rotations = recolorings = 0;
+			allocations = deallocations = 0;
+			descents = depth_sum = depth_max = 0;
+			for (size_t i = 0; i <= max_depth; i++)
+				depth[i] = 0;
+		}
+		void	descent(size_t d) {
+			descents++;
+			depth_sum += d;
+			if (d > depth_max)
+				depth_max = d;
+			depth[d < max_depth ? d : max_depth]++;
+		}
+		double	mean_depth() const { return descents ? double(depth_sum) / descents : 0; }
+	};
+		// Records the depth of one descent when it goes out of scope
+	struct tree_descent
+	{
+		tree_stats&	stats;
+		size_t		depth;
+
+		explicit tree_descent(tree_stats& s) : stats(s), depth(0) { }
+		~tree_descent() { stats.descent(depth); }
+		void	step() { depth++; }
+	};
+		// The tree's comparator, counting its calls. Copies start from zero,
+		// so counts stay with the tree through assignment and swap.
+	template <class Compare>
+	struct counted_compare
+	{
+		Compare			comp;
+		mutable size_t	calls;
+
+		counted_compare(const Compare& c = Compare()) : comp(c), calls(0) { }
+		counted_compare(const counted_compare& x) : comp(x.comp), calls(0) { }
+		counted_compare&	operator=(const counted_compare& x) {
+			comp = x.comp;
+			return *this;
+		}
+		template <class A, class B>
+		bool	operator()(const A& a, const B& b) const {
+			calls++;
+			return comp(a, b);
+		}
+	};
+
+	//TREE SHAPE
+		// Measured by walking the tree, always available. Depths count
+		// nodes from the root (depth 1); nodes[d] is the number of nodes at
+		// depth d. black_height counts the black nodes on a root-to-leaf
+		// path, valid is false if paths disagree or a red node has a red child.
+	struct tree_shape
+	{
+		size_t				size;
+		size_t				height;
+		size_t				black_height;
+		size_t				depth_sum;
+		bool				valid;
+		ft::vector<size_t>	nodes;
+
+		tree_shape() : size(0), height(0), black_height(0), depth_sum(0), valid(true) { }
+
+		double	mean_depth() const { return size ? double(depth_sum) / size : 0; }
+	};
+
+	//PRINTING
+	inline std::ostream&	operator<<(std::ostream& os, const tree_stats& s)
+	{
+		os << "comparisons " << s.comparisons << ", rotations " << s.rotations
+			<< ", recolorings " << s.recolorings << ", allocations " << s.allocations
+			<< ", deallocations " << s.deallocations << ", descents " << s.descents
+			<< " (mean depth " << s.mean_depth() << ", max " << s.depth_max << ")";
+		return os;
+	}
+	inline std::ostream&	operator<<(std::ostream& os, const tree_shape& s)
+	{
+		os << "size " << s.size << ", height " << s.height << ", black-height "
+			<< s.black_height << ", mean depth " << s.mean_depth()
+			<< (s.valid ? "" : ", INVALID") << "\n    nodes per depth:";
+		for (size_t d = 1; d < s.nodes.size(); d++)
+			os << " " << d << ":" << s.nodes[d];
+		return os;
+	}
+}
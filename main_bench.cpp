@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   main_bench.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:32:52 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/21 21:29:52 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include <cstring>
+#include <cstdlib>
+
+struct s_suite
+{
+	const char	*name;
+	void		(*run)(size_t n);
+	size_t		default_n;
+};
+
+static const s_suite	g_suites[] = {
+	{ "persistent", bench_persistent, 1000000 },
+	{ "parallel", bench_parallel, 10000000 },
+	{ "simd", bench_simd, 64 << 20 },
+	{ "deque", bench_deque, 10000000 },
+	{ "priority_queue", bench_priority_queue, 10000000 },
+	{ "setalg", bench_setalg, 1000000 },
+	{ "split", bench_split, 1000000 },
+	{ "node_handle", bench_node_handle, 100000 },
+	{ "snapshot", bench_snapshot, 10000000 },
+	{ "mapped_vector", bench_mapped_vector, 100000000 },
+	{ "threaded", bench_threaded, 10000000 },
+	{ "parallel_map", bench_parallel_map, 10000000 },
+	{ "tree_stats", bench_tree_stats, 1000000 },
+	{ "find_batch", bench_find_batch, 10000000 },
+	{ "insert_batch", bench_insert_batch, 1000000 },
+	{ "soa", bench_soa, 4000000 },
+	{ "bitvector", bench_bitvector, 100000000 },
+	{ "ring", bench_ring, 1000000 },
+	{ "arena", bench_arena, 100000 },
+	{ "pmr", bench_pmr, 1000000 },
+	{ "erase_if", bench_erase_if, 10000000 },
+	{ "segmented", bench_segmented, 10000000 },
+};
+
+static const size_t		g_nsuites = sizeof(g_suites) / sizeof(g_suites[0]);
+
+static int	usage(const char *prog) {
+	std::cerr << "usage: " << prog << " [all";
+	for (size_t i = 0; i < g_nsuites; i++)
+		std::cerr << "|" << g_suites[i].name;
+	std::cerr << "] [n] [--reps r] [--save file.json | --check file.json]"
+		" [--threshold percent] [--alpha a] [--counters]" << std::endl;
+	return 2;
+}
+
+// ./ft_bench [suite|all] [n] [options]
+//   --reps r           run the selected suites r times (default 1)
+//   --save file        record every operation's samples as a baseline
+//   --check file       compare with a baseline, exit 1 on a regression
+//   --threshold pct    slowdown of the median that counts (default 5)
+//   --alpha a          significance of the Mann-Whitney test (default 0.05)
+//   --counters         per-operation hardware counters under each result
+int	main(int argc, char **argv) {
+	const char	*which = "all";
+	size_t		n = 0;
+	size_t		reps = 1;
+	const char	*save = NULL;
+	const char	*check = NULL;
+	double		threshold = 5;
+	double		alpha = 0.05;
+	bool		counters = false;
+	int			positional = 0;
+	bool		found = false;
+
+	for (int i = 1; i < argc; i++) {
+		bool	has_value = i + 1 < argc;
+
+		if (!strcmp(argv[i], "--reps") && has_value)
+			reps = strtoul(argv[++i], NULL, 10);
+		else if (!strcmp(argv[i], "--save") && has_value)
+			save = argv[++i];
+		else if (!strcmp(argv[i], "--check") && has_value)
+			check = argv[++i];
+		else if (!strcmp(argv[i], "--threshold") && has_value)
+			threshold = strtod(argv[++i], NULL);
+		else if (!strcmp(argv[i], "--alpha") && has_value)
+			alpha = strtod(argv[++i], NULL);
+		else if (!strcmp(argv[i], "--counters"))
+			counters = true;
+		else if (!strncmp(argv[i], "--", 2) || positional == 2)
+			return usage(argv[0]);
+		else if (positional++ == 0)
+			which = argv[i];
+		else
+			n = strtoul(argv[i], NULL, 10);
+	}
+	if (reps == 0 || (save && check))
+		return usage(argv[0]);
+	if (counters)
+		bench_counters_open();
+	for (size_t r = 0; r < reps; r++) {
+		if (reps > 1)
+			std::cout << "\n== repetition " << r + 1 << "/" << reps << " ==" << std::endl;
+		for (size_t i = 0; i < g_nsuites; i++) {
+			if (strcmp(which, "all") && strcmp(which, g_suites[i].name))
+				continue;
+			found = true;
+			g_suites[i].run(n ? n : g_suites[i].default_n);
+		}
+		if (!found)
+			return usage(argv[0]);
+	}
+	bench_counters_close();
+	if (save && !bench_save(save))
+		return 2;
+	if (check)
+		return bench_check(check, threshold, alpha) ? 0 : 1;
+	return 0;
+}
@@ -6,17 +6,27 @@
 /*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/12/13 23:09:44 by moabid            #+#    #+#             */
-/*   Updated: 2022/12/13 23:31:49 by moabid           ###   ########.fr       */
+/*   Updated: 2026/10/22 13:08:56 by moabid           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "map.hpp"
+#include "persistent_map.hpp"
+#include "arena.hpp"
+#include "memory_resource.hpp"
+#include "snapshot.hpp"
+#include "tester.hpp"
 #include <map>
+#include <algorithm>
+#include <iterator>
+#include <vector>
 #include <string>
 #include <iostream>
+#include <sstream>
 #include <sys/time.h>
 #include "utility.hpp"
 #include <cstring>
+#include <cmath>
 #include <stddef.h>
 #include <stdlib.h>
 
@@ -60,6 +70,20 @@ void	compare_values(ft::map<K, V>& mappie, ft::pair<K, V> compelem = ft::make_pa
 	}
 }
 
+// Copies the pairs of any map into a std::vector, to compare ft with std
+template< typename M >
+std::vector<std::pair<typename M::key_type, typename M::mapped_type> >	contents(const M& m) {
+	std::vector<std::pair<typename M::key_type, typename M::mapped_type> >	out;
+	for (typename M::const_iterator it = m.begin(); it != m.end(); ++it)
+		out.push_back(std::make_pair(it->first, it->second));
+	return out;
+}
+
+template< typename T >
+void	check(const std::string& name, const T& stl, const T& ft) {
+	std::cout << name << ": " << equal(stl, ft) << std::endl;
+}
+
 ft::map<int, std::string>	getstlmap() {
 	ft::map<int, std::string> stl;
 	stl[10] = "ten";
@@ -424,6 +448,582 @@ void	telly() {
 	 }
 }
 
+void	persistent_test() {
+	ft::persistent_map<int, int>	pm;
+	std::map<int, int>				stl;
+	ft::persistent_map<int, int>	snaps[4];
+	std::map<int, int>				stl_snaps[4];
+
+	srand(26);
+	for (int i = 0; i < 4000; i++) {
+		int	k = rand() % 500;
+		if (i % 5 == 4) {
+			pm.erase(k);
+			stl.erase(k);
+		}
+		else if (i % 3 == 0) {
+			pm.insert_or_assign(k, i);
+			stl[k] = i;
+		}
+		else {
+			pm.insert(ft::make_pair(k, i));
+			stl.insert(std::make_pair(k, i));
+		}
+		if (i % 1000 == 999) {
+			snaps[i / 1000] = pm.snapshot();
+			stl_snaps[i / 1000] = stl;
+		}
+	}
+	check("persistent_map content", contents(stl), contents(pm));
+	bool	snapshots_ok = true;
+	for (int i = 0; i < 4; i++)
+		snapshots_ok = snapshots_ok && contents(stl_snaps[i]) == contents(snaps[i]);
+	check("persistent_map snapshots", true, snapshots_ok);
+	check("persistent_map lower_bound", stl.lower_bound(250)->first, pm.lower_bound(250)->first);
+	std::cout << "persistent_map.at(-1) ";
+	try {
+		pm.at(-1);
+		std::cout << "did not throw" << std::endl;
+	}
+	catch (std::out_of_range& e) {
+		std::cout << "throws" << std::endl;
+	}
+}
+
+// Random maps of size n with keys below range, the same in ft and std
+void	random_maps(ft::map<int, int>& m, std::map<int, int>& stl, int n, int range) {
+	for (int i = 0; i < n; i++) {
+		int	k = rand() % range;
+		m[k] = i;
+		stl[k] = i;
+	}
+}
+
+struct add_values {
+	void	operator()(ft::pair<const int, int>& mine, const ft::pair<const int, int>& theirs) const {
+		mine.second += theirs.second;
+	}
+};
+
+void	set_algebra_test() {
+	static const int	sizes[][2] = { { 3000, 3000 }, { 3000, 30 }, { 30, 3000 }, { 0, 100 } };
+
+	srand(32);
+	for (int t = 0; t < 4; t++) {
+		ft::map<int, int>	a, b;
+		std::map<int, int>	stl_a, stl_b;
+		std::map<int, int>	stl_union, stl_inter, stl_diff;
+
+		random_maps(a, stl_a, sizes[t][0], 5000);
+		random_maps(b, stl_b, sizes[t][1], 5000);
+		stl_union = stl_b;
+		for (std::map<int, int>::iterator it = stl_a.begin(); it != stl_a.end(); ++it) {
+			if (stl_b.count(it->first)) {
+				stl_union[it->first] += it->second;
+				stl_inter[it->first] = it->second;
+			}
+			else {
+				stl_union[it->first] = it->second;
+				stl_diff[it->first] = it->second;
+			}
+		}
+		ft::map<int, int>	u(a), i(a), d(a), moved(b);
+		u.set_union(moved, add_values());
+		i.set_intersection(b);
+		d.set_difference(b);
+		std::cout << "set algebra " << sizes[t][0] << " and " << sizes[t][1] << std::endl;
+		check("  set_union", contents(stl_union), contents(u));
+		check("  set_union empties x", true, moved.empty());
+		check("  set_intersection", contents(stl_inter), contents(i));
+		check("  set_difference", contents(stl_diff), contents(d));
+		check("  sizes", stl_union.size() + stl_inter.size() + stl_diff.size(), u.size() + i.size() + d.size());
+	}
+}
+
+void	split_join_test() {
+	ft::map<int, int>	m, upper, middle;
+	std::map<int, int>	stl;
+
+	srand(33);
+	random_maps(m, stl, 5000, 20000);
+	m.split(15000, upper);
+	m.split(5000, middle);
+	std::map<int, int>	stl_lower(stl.begin(), stl.lower_bound(5000));
+	std::map<int, int>	stl_middle(stl.lower_bound(5000), stl.lower_bound(15000));
+	std::map<int, int>	stl_upper(stl.lower_bound(15000), stl.end());
+	check("split lower part", contents(stl_lower), contents(m));
+	check("split middle part", contents(stl_middle), contents(middle));
+	check("split upper part", contents(stl_upper), contents(upper));
+	check("split sizes", stl_lower.size() * 1000000 + stl_middle.size() * 1000 + stl_upper.size(),
+		m.size() * 1000000 + middle.size() * 1000 + upper.size());
+	middle.join(upper);
+	m.join(middle);
+	check("join", contents(stl), contents(m));
+	check("join size", stl.size(), m.size());
+	check("join empties upper", true, upper.empty() && middle.empty());
+	ft::map<int, int>	overlap;
+	overlap[-1] = 1;
+	overlap[2500] = 2;
+	stl.insert(std::make_pair(-1, 1));
+	stl.insert(std::make_pair(2500, 2));
+	m.join(overlap);
+	check("join of overlapping keys", contents(stl), contents(m));
+}
+
+void	node_handle_test() {
+	ft::map<int, int>	a, b;
+	std::map<int, int>	stl_a, stl_b;
+	int					collisions = 0;
+	int					stl_collisions = 0;
+
+	srand(34);
+	random_maps(a, stl_a, 2000, 4000);
+	random_maps(b, stl_b, 2000, 4000);
+	for (int i = 0; i < 500; i++) {
+		int	k = rand() % 4000;
+		ft::map<int, int>::node_type	nh = a.extract(k);
+		if (nh.empty() != (stl_a.count(k) == 0))
+			std::cout << "extract " << k << " " << equal(true, false) << std::endl;
+		if (nh.empty())
+			continue ;
+		int	v = stl_a[k];
+		stl_a.erase(k);
+		nh.key() = k + 1;
+		nh.mapped() += 7;
+		ft::map<int, int>::insert_return_type	ret = b.insert(std::move(nh));
+		if (!ret.inserted)
+			collisions += ret.node.key() == k + 1 && ret.position->first == k + 1;
+		if (!stl_b.insert(std::make_pair(k + 1, v + 7)).second)
+			stl_collisions++;
+	}
+	check("extract", contents(stl_a), contents(a));
+	check("insert(node_type&&)", contents(stl_b), contents(b));
+	check("insert(node_type&&) collisions", stl_collisions, collisions);
+	a.merge(b);
+	for (std::map<int, int>::iterator it = stl_b.begin(); it != stl_b.end(); )
+		if (stl_a.insert(*it).second)
+			stl_b.erase(it++);
+		else
+			++it;
+	check("merge target", contents(stl_a), contents(a));
+	check("merge source keeps duplicates", contents(stl_b), contents(b));
+}
+
+typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, true>	threaded_map;
+
+void	threaded_test() {
+	threaded_map		m;
+	std::map<int, int>	stl;
+
+	srand(37);
+	for (int i = 0; i < 20000; i++) {
+		int	k = rand() % 5000;
+		if (rand() % 3) {
+			m[k] = i;
+			stl[k] = i;
+		}
+		else {
+			m.erase(k);
+			stl.erase(k);
+		}
+	}
+	check("threaded insert/erase", contents(stl), contents(m));
+	std::vector<std::pair<int, int> >	back, stl_back;
+	for (threaded_map::reverse_iterator it = m.rbegin(); it != m.rend(); ++it)
+		back.push_back(std::make_pair(it->first, it->second));
+	for (std::map<int, int>::reverse_iterator it = stl.rbegin(); it != stl.rend(); ++it)
+		stl_back.push_back(std::make_pair(it->first, it->second));
+	check("threaded reverse iteration", stl_back, back);
+	int	sum = 0, stl_sum = 0;
+	for (int lo = 0; lo < 5000; lo += 250) {
+		threaded_map::iterator			it = m.lower_bound(lo), last = m.upper_bound(lo + 100);
+		std::map<int, int>::iterator	stl_it = stl.lower_bound(lo), stl_last = stl.upper_bound(lo + 100);
+		for ( ; it != last; ++it)
+			sum += it->second;
+		for ( ; stl_it != stl_last; ++stl_it)
+			stl_sum += stl_it->second;
+	}
+	check("threaded range scans", stl_sum, sum);
+	m.erase(m.lower_bound(1000), m.lower_bound(2000));
+	stl.erase(stl.lower_bound(1000), stl.lower_bound(2000));
+	check("threaded range erase", contents(stl), contents(m));
+	threaded_map	copy(m), upper;
+	copy.split(3000, upper);
+	copy.join(upper);
+	check("threaded copy, split and join", contents(stl), contents(copy));
+	threaded_map	other;
+	other[-5] = 5;
+	other[1500] = 1;
+	m.swap(other);
+	m.set_union(other);
+	stl.insert(std::make_pair(-5, 5));
+	stl.insert(std::make_pair(1500, 1));
+	check("threaded swap and set_union", contents(stl), contents(m));
+	check("threaded end step", stl.rbegin()->first, (--m.end())->first);
+}
+
+// Concatenates the subranges of a partition, noting the largest one
+template< typename It >
+std::vector<std::pair<int, int> >	partition_contents(const ft::vector<It>& bounds, size_t& largest) {
+	std::vector<std::pair<int, int> >	out;
+
+	largest = 0;
+	for (size_t i = 0; i + 1 < bounds.size(); i++) {
+		size_t	before = out.size();
+		for (It it = bounds[i]; it != bounds[i + 1]; ++it)
+			out.push_back(std::make_pair(it->first, it->second));
+		largest = std::max(largest, out.size() - before);
+	}
+	return out;
+}
+
+void	partition_test() {
+	ft::map<int, int>	m;
+	std::map<int, int>	stl;
+	size_t				largest;
+
+	srand(38);
+	for (int i = 0; i < 100000; i++) {
+		m[i] = i;
+		stl[i] = i;
+	}
+	for (int i = 0; i < 100000; i += 1 + i % 3) {
+		m.erase(i);
+		stl.erase(i);
+	}
+	random_maps(m, stl, 20000, 200000);
+	for (size_t k = 1; k <= 64; k *= 4) {
+		ft::vector<ft::map<int, int>::iterator>	bounds = m.partition(k);
+		std::cout << "partition into " << k << std::endl;
+		check("  covers the map in order", contents(stl), partition_contents(bounds, largest));
+		check("  k subranges", k + 1, bounds.size());
+		check("  equal sizes", (stl.size() + k - 1) / k, largest);
+	}
+	const ft::map<int, int>&						cm = m;
+	ft::vector<ft::map<int, int>::const_iterator>	bounds = cm.partition(cm.lower_bound(30000), cm.lower_bound(160000), 8);
+	std::vector<std::pair<int, int> >				stl_range(stl.lower_bound(30000), stl.lower_bound(160000));
+	check("partition of a subrange", stl_range, partition_contents(bounds, largest));
+	check("partition of a subrange, equal sizes", (stl_range.size() + 7) / 8, largest);
+	ft::map<int, int>::const_iterator	five = cm.lower_bound(150000);
+	for (int i = 0; i < 5; i++)
+		++five;
+	bounds = cm.partition(cm.lower_bound(150000), five, 8);
+	check("partition of 5 entries into 8", size_t(6), bounds.size());
+}
+
+void	find_batch_test() {
+	ft::map<int, int>	m;
+	std::map<int, int>	stl;
+	std::vector<int>	keys;
+
+	srand(42);
+	random_maps(m, stl, 5000, 10000);
+	for (int i = 0; i < 1000; i++)
+		keys.push_back(rand() % 10000);
+	std::vector<ft::map<int, int>::iterator>	found(keys.size());
+	std::vector<int>							counts(keys.size());
+	std::vector<std::pair<int, int> >			hits, stl_hits;
+	std::vector<int>							stl_counts;
+	m.find_batch(keys.begin(), keys.end(), found.begin());
+	size_t	n = m.count_batch(keys.begin(), keys.end(), counts.begin());
+	size_t	stl_n = 0;
+	for (size_t i = 0; i < keys.size(); i++) {
+		std::map<int, int>::iterator	it = stl.find(keys[i]);
+		if (it != stl.end())
+			stl_hits.push_back(*it);
+		else
+			stl_hits.push_back(std::make_pair(-1, -1));
+		if (found[i] != m.end())
+			hits.push_back(std::make_pair(found[i]->first, found[i]->second));
+		else
+			hits.push_back(std::make_pair(-1, -1));
+		stl_counts.push_back(stl.count(keys[i]));
+		stl_n += stl.count(keys[i]);
+	}
+	check("find_batch", stl_hits, hits);
+	check("count_batch", stl_counts, counts);
+	check("count_batch total", stl_n, n);
+}
+
+void	insert_batch_test() {
+	static const int	sizes[] = { 20, 500, 20000 };
+
+	srand(43);
+	for (int t = 0; t < 3; t++) {
+		ft::map<int, int>						m;
+		std::map<int, int>						stl;
+		std::vector<ft::pair<int, int> >		batch;
+		std::vector<ft::map<int, int>::iterator>	inserted;
+		std::vector<int>						new_keys, stl_new_keys;
+
+		random_maps(m, stl, 5000, 20000);
+		for (int i = 0; i < sizes[t]; i++) {
+			int	k = rand() % 20000;
+			batch.push_back(ft::make_pair(k, -i));
+			if (stl.insert(std::make_pair(k, -i)).second)
+				stl_new_keys.push_back(k);
+		}
+		std::sort(stl_new_keys.begin(), stl_new_keys.end());
+		m.insert_batch(batch.begin(), batch.end(), std::back_inserter(inserted));
+		for (size_t i = 0; i < inserted.size(); i++)
+			new_keys.push_back(inserted[i]->first);
+		std::cout << "insert_batch of " << sizes[t] << std::endl;
+		check("  contents", contents(stl), contents(m));
+		check("  inserted, in key order", stl_new_keys, new_keys);
+		check("  size", stl.size(), m.size());
+	}
+}
+
+typedef ft::arena_allocator<ft::pair<const int, int> >	arena_pairs;
+typedef ft::map<int, int, std::less<int>, arena_pairs>	arena_map;
+
+void	arena_test() {
+	ft::arena			a, b;
+	std::less<int>		less;
+	std::map<int, int>	stl, stl_other;
+	size_t				reserved;
+
+	srand(47);
+	{
+		arena_map	m(less, arena_pairs(a));
+		arena_map	other(less, arena_pairs(a));
+
+		for (int i = 0; i < 20000; i++) {
+			int	k = rand() % 5000;
+			if (rand() % 4) {
+				m[k] = i;
+				stl[k] = i;
+			}
+			else {
+				m.erase(k);
+				stl.erase(k);
+			}
+			other[k + 5000] = i;
+			stl_other[k + 5000] = i;
+		}
+		check("arena map insert/erase", contents(stl), contents(m));
+		m.merge(other);
+		stl.insert(stl_other.begin(), stl_other.end());
+		check("arena map merge within one arena", contents(stl), contents(m));
+		check("arena map merge empties source", true, other.empty() && a.used() > 0);
+		reserved = a.reserved();
+
+		arena_map	foreign(less, arena_pairs(b));
+		int			refused = 0;
+		foreign[-1] = 1;
+		try {
+			m.merge(foreign);
+		}
+		catch (std::invalid_argument&) {
+			refused++;
+		}
+		try {
+			m.split(2500, foreign);
+		}
+		catch (std::invalid_argument&) {
+			refused++;
+		}
+		try {
+			m.insert(foreign.extract(-1));
+		}
+		catch (std::invalid_argument&) {
+			refused++;
+		}
+		check("arena map refuses nodes of another arena", 3, refused);
+		check("arena map unchanged by refusals", contents(stl), contents(m));
+	}
+	a.reset();
+	{
+		arena_map	m(less, arena_pairs(a));
+		for (std::map<int, int>::iterator it = stl.begin(); it != stl.end(); ++it)
+			m.insert(ft::make_pair(it->first, it->second));
+		check("arena map after reset", contents(stl), contents(m));
+	}
+	check("arena reuses its chunks after reset", reserved, a.reserved());
+}
+
+// Upstream resource counting the bytes it has handed out and not got back
+class counting_resource : public ft::pmr::memory_resource
+{
+	public:
+		counting_resource() : outstanding(0), calls(0) { }
+
+		size_t	outstanding;
+		size_t	calls;
+
+	protected:
+		void	*do_allocate(size_t bytes, size_t align) {
+			outstanding += bytes;
+			calls++;
+			return ft::pmr::new_delete_resource()->allocate(bytes, align);
+		}
+		void	do_deallocate(void *p, size_t bytes, size_t align) {
+			outstanding -= bytes;
+			ft::pmr::new_delete_resource()->deallocate(p, bytes, align);
+		}
+};
+
+void	pmr_test() {
+	counting_resource	upstream;
+	std::map<int, int>	stl;
+	std::vector<int>	stl_values;
+
+	srand(48);
+	{
+		ft::pmr::unsynchronized_pool_resource	pool(&upstream);
+		ft::pmr::map<int, int>					m(std::less<int>(), &pool);
+		ft::pmr::vector<int>					values(&pool);
+
+		for (int i = 0; i < 20000; i++) {
+			int	k = rand() % 5000;
+			if (rand() % 4) {
+				m[k] = i;
+				stl[k] = i;
+			}
+			else {
+				m.erase(k);
+				stl.erase(k);
+			}
+			values.push_back(k);
+			stl_values.push_back(k);
+		}
+		check("pmr map on a pool", contents(stl), contents(m));
+		check("pmr vector on a pool", stl_values, std::vector<int>(values.begin(), values.end()));
+		check("pmr pool draws chunks from upstream", true, upstream.calls > 0 && upstream.calls < 1000);
+		ft::pmr::map<int, int>	copy(m);
+		check("pmr copy", true, copy == m);
+		ft::pmr::monotonic_buffer_resource	mono;
+		ft::pmr::map<int, int>				other(std::less<int>(), &mono);
+		other[1] = 1;
+		bool	thrown = false;
+		try {
+			m.merge(other);
+		}
+		catch (std::invalid_argument&) {
+			thrown = true;
+		}
+		check("pmr merge across resources throws", true, thrown && other.size() == 1);
+	}
+	check("pmr pool returns everything upstream", size_t(0), upstream.outstanding);
+}
+
+// Loads bytes into c, true when it throws ft::snapshot_error
+template< typename C >
+bool	snapshot_throws(const std::string& bytes, C& c) {
+	std::istringstream	is(bytes);
+
+	try {
+		ft::load_snapshot(is, c);
+	}
+	catch (ft::snapshot_error&) {
+		return true;
+	}
+	return false;
+}
+
+// Flips one byte of bytes at pos
+std::string	flipped(std::string bytes, size_t pos) {
+	bytes[pos] ^= 0x20;
+	return bytes;
+}
+
+void	snapshot_test() {
+	ft::map<int, std::string>	m, loaded_m;
+	std::map<int, std::string>	stl;
+	ft::vector<double>			v, loaded_v;
+	ft::vector<bool>			bits, loaded_bits;
+	std::ostringstream			os_m, os_v, os_bits;
+
+	srand(35);
+	for (int i = 0; i < 30000; i++) {
+		int	k = rand() % 100000;
+		m[k] = std::string(k % 17, 'a' + k % 26);
+		stl[k] = m[k];
+		v.push_back(k / 7.0);
+		v.push_back(-k / 3.0);
+		bits.push_back(k % 3 == 0);
+	}
+	ft::save_snapshot(os_m, m);
+	ft::save_snapshot(os_v, v);
+	ft::save_snapshot(os_bits, bits);
+	std::string	bytes_m = os_m.str(), bytes_v = os_v.str(), bytes_bits = os_bits.str();
+	check("snapshot round trip of a map", true, !snapshot_throws(bytes_m, loaded_m) && contents(stl) == contents(loaded_m));
+	check("snapshot round trip of a vector<double>", true, !snapshot_throws(bytes_v, loaded_v) && loaded_v == v);
+	check("snapshot round trip of a vector<bool>", true, !snapshot_throws(bytes_bits, loaded_bits) && loaded_bits == bits);
+
+	// The header is 48 bytes, each block has a length and a checksum
+	// around its payload and the end marker is the last 16 bytes. The
+	// map and the vector<double> span several blocks, so a bad last
+	// block fails mid-load.
+	size_t	size = bytes_m.size();
+	check("snapshot flipped header byte", true, snapshot_throws(flipped(bytes_m, 33), loaded_m));
+	check("snapshot flipped block byte", true, snapshot_throws(flipped(bytes_m, size - 40), loaded_m));
+	check("snapshot map failing mid-load left empty", true, loaded_m.empty());
+	snapshot_throws(bytes_m, loaded_m);
+	check("snapshot flipped end marker byte", true, snapshot_throws(flipped(bytes_m, size - 1), loaded_m) && loaded_m.empty());
+	check("snapshot truncated", true, snapshot_throws(bytes_m.substr(0, size / 2), loaded_m)
+		&& snapshot_throws(bytes_m.substr(0, size - 8), loaded_m));
+	check("snapshot vector<double> flipped block byte, left empty", true,
+		snapshot_throws(flipped(bytes_v, bytes_v.size() - 40), loaded_v) && loaded_v.empty());
+	check("snapshot vector<bool> truncated, left empty", true,
+		snapshot_throws(bytes_bits.substr(0, bytes_bits.size() - 20), loaded_bits) && loaded_bits.empty());
+}
+
+// The walk must count every node, find no red-black violation and a
+// height within the red-black bound 2 log2(n + 1)
+bool	shape_ok(const ft::map<int, int>& m) {
+	ft::tree_shape	s = m.shape();
+	size_t			nodes = 0;
+
+	for (size_t d = 0; d < s.nodes.size(); d++)
+		nodes += s.nodes[d];
+	return s.valid && s.size == m.size() && nodes == m.size() && s.height <= 2 * std::log2(m.size() + 1.0);
+}
+
+void	shape_test() {
+	ft::map<int, int>	empty, random, ascending, descending;
+	std::map<int, int>	stl;
+
+	srand(41);
+	random_maps(random, stl, 20000, 100000);
+	for (int i = 0; i < 50000; i++) {
+		ascending[i] = i;
+		descending[-i] = i;
+	}
+	check("shape of an empty map", true, shape_ok(empty) && empty.shape().height == 0);
+	check("shape of a random map", true, shape_ok(random));
+	check("shape after ascending inserts", true, shape_ok(ascending));
+	check("shape after descending inserts", true, shape_ok(descending));
+	for (int i = 0; i < 100000; i++)
+		random.erase(rand() % 100000);
+	for (int i = 0; i < 50000; i += 1 + i % 3)
+		ascending.erase(i);
+	check("shape after erases", true, shape_ok(random) && shape_ok(ascending));
+
+#ifdef FT_TREE_STATS
+	ft::map<int, int>	m;
+	std::vector<int>	keys;
+	for (int i = 0; i < 1000; i++) {
+		keys.push_back(i);
+		std::swap(keys[i], keys[rand() % (i + 1)]);
+	}
+	for (size_t i = 0; i < keys.size(); i++)
+		m.insert(ft::make_pair(keys[i], 0));
+	for (int i = 0; i < 500; i++)
+		m.erase(keys[i]);
+	ft::tree_stats	stats = m.stats();
+	size_t			depths = 0;
+	for (size_t d = 0; d <= ft::tree_stats::max_depth; d++)
+		depths += stats.depth[d];
+	check("stats allocations and deallocations", true, stats.allocations == 1000 && stats.deallocations == 500);
+	check("stats descents", true, stats.descents >= 1000 && depths == stats.descents && stats.comparisons > 0
+		&& stats.depth_max <= 2 * std::log2(1001.0));
+	m.reset_stats();
+	stats = m.stats();
+	check("reset_stats", true, stats.comparisons == 0 && stats.allocations == 0 && stats.descents == 0);
+#endif
+}
+
 void	bs() {
 	ft::map<int, std::string> hats = getstlmap();
 	ft::map<int, std::string>::iterator it = hats.begin();
@@ -437,6 +1037,18 @@ int	main(int argc, char **argv) {
 	}
 	iterators();
 	capacity();
+	persistent_test();
+	set_algebra_test();
+	split_join_test();
+	node_handle_test();
+	threaded_test();
+	partition_test();
+	find_batch_test();
+	insert_batch_test();
+	arena_test();
+	pmr_test();
+	snapshot_test();
+	shape_test();
 	if (argc >= 2 && strcmp(argv[1], "time") == 0) {
 		gettimeofday(&tv, NULL);
 		endtime = tv.tv_usec;
@@ -6,18 +6,36 @@
 /*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/12/13 22:40:14 by moabid            #+#    #+#             */
-/*   Updated: 2022/12/13 23:11:18 by moabid           ###   ########.fr       */
+/*   Updated: 2026/10/22 14:38:48 by moabid           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "vector.hpp"
+#include "deque.hpp"
+#include "stack.hpp"
+#include "queue.hpp"
+#include "priority_queue.hpp"
+#include "mapped_vector.hpp"
+#include "soa_vector.hpp"
+#include "ring.hpp"
+#include "segmented_vector.hpp"
+#include "parallel_algorithm.hpp"
+#include "tester.hpp"
 #include <vector>
+#include <deque>
+#include <stack>
+#include <queue>
+#include <algorithm>
+#include <numeric>
 #include <string>
 #include <iostream>
 #include <sys/time.h>
 #include <cstring>
+#include <cmath>
 #include <stddef.h>
 #include <stdlib.h>
+#include <unistd.h>
+#include <pthread.h>
 
 size_t begintime;
 size_t endtime;
@@ -39,6 +57,17 @@ void	reverse_print_container_content(ft::vector<T> &vec, const std::string& name
 	std::cout << " $" << std::endl;
 }
 
+// Copies any sequence into a std::vector, to compare ft with std
+template< typename C >
+std::vector<typename C::value_type>	contents(const C& c) {
+	return std::vector<typename C::value_type>(c.begin(), c.end());
+}
+
+template< typename T >
+void	check(const std::string& name, const T& stl, const T& ft) {
+	std::cout << name << ": " << equal(stl, ft) << std::endl;
+}
+
 void	constructors_test() {
 	int i = 8;
 	ft::vector<int> def;
@@ -231,6 +260,840 @@ void	testVstresstest()
 	// printVector(stressVec);
 }
 
+void	deque_test() {
+	ft::deque<int>	dq;
+	std::deque<int>	stl;
+
+	srand(30);
+	for (int i = 0; i < 20000; i++) {
+		int	op = rand() % 8;
+		if (op < 3) {
+			dq.push_back(i);
+			stl.push_back(i);
+		}
+		else if (op < 5) {
+			dq.push_front(i);
+			stl.push_front(i);
+		}
+		else if (op == 5 && !stl.empty()) {
+			dq.pop_back();
+			stl.pop_back();
+		}
+		else if (op == 6 && !stl.empty()) {
+			dq.pop_front();
+			stl.pop_front();
+		}
+		else if (op == 7 && i % 16 == 0) {
+			size_t	pos = stl.empty() ? 0 : rand() % stl.size();
+			dq.insert(dq.begin() + pos, 3, i);
+			stl.insert(stl.begin() + pos, 3, i);
+			if (stl.size() > 4) {
+				dq.erase(dq.begin() + 1, dq.begin() + 3);
+				stl.erase(stl.begin() + 1, stl.begin() + 3);
+			}
+		}
+	}
+	check("deque push/pop/insert/erase", contents(stl), contents(dq));
+	check("deque operator[]", stl[stl.size() / 2], dq[dq.size() / 2]);
+	check("deque reverse", std::vector<int>(stl.rbegin(), stl.rend()), std::vector<int>(dq.rbegin(), dq.rend()));
+	ft::deque<int>	copy(dq);
+	copy.resize(10);
+	stl.resize(10);
+	check("deque copy and resize", contents(stl), contents(copy));
+	check("deque relational", true, copy < dq && copy != dq && dq == ft::deque<int>(dq));
+}
+
+void	adaptors_test() {
+	ft::stack<int>				st;
+	std::stack<int>				stl_st;
+	ft::queue<int>				q;
+	std::queue<int>				stl_q;
+	ft::priority_queue<int>		pq;
+	std::priority_queue<int>	stl_pq;
+	std::vector<int>			popped[3];
+	std::vector<int>			stl_popped[3];
+
+	srand(31);
+	for (int i = 0; i < 20000; i++) {
+		int	v = rand() % 1000;
+		if (rand() % 3 != 0) {
+			st.push(v);
+			stl_st.push(v);
+			q.push(v);
+			stl_q.push(v);
+			pq.push(v);
+			stl_pq.push(v);
+		}
+		else if (!stl_st.empty()) {
+			popped[0].push_back(st.top());
+			stl_popped[0].push_back(stl_st.top());
+			popped[1].push_back(q.front());
+			stl_popped[1].push_back(stl_q.front());
+			popped[2].push_back(pq.top());
+			stl_popped[2].push_back(stl_pq.top());
+			st.pop();
+			stl_st.pop();
+			q.pop();
+			stl_q.pop();
+			pq.pop();
+			stl_pq.pop();
+		}
+	}
+	check("stack top/pop", stl_popped[0], popped[0]);
+	check("queue front/pop", stl_popped[1], popped[1]);
+	check("priority_queue top/pop", stl_popped[2], popped[2]);
+	check("adaptors size", stl_st.size() + stl_q.size() + stl_pq.size(), st.size() + q.size() + pq.size());
+
+	std::vector<int>	range;
+	for (int i = 0; i < 1000; i++)
+		range.push_back(rand() % 100);
+	pq.push_range(range.begin(), range.end());
+	for (size_t i = 0; i < range.size(); i++)
+		stl_pq.push(range[i]);
+	popped[2].clear();
+	stl_popped[2].clear();
+	for ( ; !stl_pq.empty(); stl_pq.pop(), pq.pop()) {
+		popped[2].push_back(pq.top());
+		stl_popped[2].push_back(stl_pq.top());
+	}
+	check("priority_queue push_range", stl_popped[2], popped[2]);
+
+	ft::indexed_priority_queue<int>	ipq;
+	std::vector<int>				keys(100);
+	for (size_t id = 0; id < keys.size(); id++) {
+		keys[id] = rand() % 1000;
+		ipq.push(id, keys[id]);
+	}
+	for (size_t id = 0; id < keys.size(); id += 3) {
+		keys[id] = rand() % 1000;
+		ipq.update(id, keys[id]);
+	}
+	ipq.erase(7);
+	keys[7] = -1;
+	std::sort(keys.begin(), keys.end());
+	keys.erase(keys.begin());
+	std::vector<int>	order;
+	for ( ; !ipq.empty(); ipq.pop())
+		order.insert(order.begin(), ipq.top());
+	check("indexed_priority_queue update/erase", keys, order);
+}
+
+void	mapped_vector_test() {
+	const char				*path = "/tmp/ft_mapped_vector_test";
+	std::vector<int>		stl;
+	int						chunk[64];
+
+	unlink(path);
+	srand(36);
+	{
+		ft::mapped_vector<int>	mv(path);
+
+		for (int i = 0; i < 100000; i++) {
+			int	op = rand() % 10;
+			if (op < 5) {
+				mv.push_back(i);
+				stl.push_back(i);
+			}
+			else if (op < 7 && !stl.empty()) {
+				size_t	pos = rand() % stl.size();
+				mv[pos] = -i;
+				stl[pos] = -i;
+			}
+			else if (op == 7 && !stl.empty()) {
+				mv.pop_back();
+				stl.pop_back();
+			}
+			else if (op == 8 && i % 32 == 0) {
+				for (int j = 0; j < 64; j++)
+					chunk[j] = i + j;
+				mv.append(chunk, 64);
+				stl.insert(stl.end(), chunk, chunk + 64);
+			}
+			else if (op == 9 && i % 512 == 0) {
+				mv.resize(stl.size() / 2, i);
+				stl.resize(stl.size() / 2, i);
+			}
+		}
+		check("mapped_vector push/pop/append/resize", stl, std::vector<int>(mv.begin(), mv.end()));
+		mv.sync();
+		mv.clear();
+		stl.clear();
+		for (int i = 0; i < 1000; i++) {
+			mv.push_back(i * 7);
+			stl.push_back(i * 7);
+		}
+		mv.shrink_to_fit();
+		mv.sync();
+	}
+	ft::mapped_vector<int>	reopened(path);
+	check("mapped_vector reopen after clear", stl, std::vector<int>(reopened.begin(), reopened.end()));
+	bool	thrown = false;
+	try {
+		reopened.at(stl.size());
+	}
+	catch (std::out_of_range&) {
+		thrown = true;
+	}
+	check("mapped_vector at", true, thrown && reopened.capacity() >= reopened.size());
+	ft::mapped_vector<int>	other;
+	ft::swap(reopened, other);
+	check("mapped_vector swap", true, !reopened.is_open() && other.is_open()
+		&& std::vector<int>(other.begin(), other.end()) == stl);
+	other.close();
+	unlink(path);
+}
+
+
+typedef ft::soa_vector<int, double, std::string>	soa_rows;
+
+// Copies the rows of a soa_vector into one std::vector per field
+void	soa_contents(const soa_rows& soa, std::vector<int>& ids, std::vector<double>& weights, std::vector<std::string>& names) {
+	ids.clear();
+	weights.clear();
+	names.clear();
+	for (size_t i = 0; i < soa.size(); i++) {
+		ids.push_back(soa[i].get<0>());
+		weights.push_back(soa[i].get<1>());
+		names.push_back(soa[i].get<2>());
+	}
+}
+
+void	soa_vector_test() {
+	soa_rows					soa;
+	std::vector<int>			ids, stl_ids;
+	std::vector<double>			weights, stl_weights;
+	std::vector<std::string>	names, stl_names;
+
+	srand(44);
+	for (int i = 0; i < 20000; i++) {
+		int	op = rand() % 8;
+		if (op < 5) {
+			soa.push_back(i, i * 0.5, std::string(i % 7, 'a' + i % 26));
+			stl_ids.push_back(i);
+			stl_weights.push_back(i * 0.5);
+			stl_names.push_back(std::string(i % 7, 'a' + i % 26));
+		}
+		else if (op == 5 && !stl_ids.empty()) {
+			soa.pop_back();
+			stl_ids.pop_back();
+			stl_weights.pop_back();
+			stl_names.pop_back();
+		}
+		else if (op == 6 && !stl_ids.empty()) {
+			size_t	to = rand() % stl_ids.size();
+			size_t	from = rand() % stl_ids.size();
+			soa[to] = soa[from];
+			stl_ids[to] = stl_ids[from];
+			stl_weights[to] = stl_weights[from];
+			stl_names[to] = stl_names[from];
+		}
+		else if (op == 7 && i % 64 == 0) {
+			size_t	n = stl_ids.size() / 2 + rand() % 100;
+			soa.resize(n);
+			stl_ids.resize(n);
+			stl_weights.resize(n);
+			stl_names.resize(n);
+		}
+	}
+	soa_contents(soa, ids, weights, names);
+	check("soa_vector push_back/pop_back/resize", stl_ids, ids);
+	check("soa_vector second column", stl_weights, weights);
+	check("soa_vector third column", stl_names, names);
+	ft::span<double>	column = soa.column<1>();
+	double				sum = 0;
+	for (size_t i = 0; i < column.size(); i++)
+		sum += column[i];
+	check("soa_vector column", std::accumulate(stl_weights.begin(), stl_weights.end(), 0.0), sum);
+	soa_rows	copy(soa), other;
+	copy.front().assign(-1, -1.0, "front");
+	other = copy;
+	other.swap(soa);
+	soa_contents(soa, ids, weights, names);
+	stl_ids.front() = -1;
+	stl_names.front() = "front";
+	check("soa_vector copy, assign and swap", stl_ids, ids);
+	check("soa_vector copy, assign and swap names", stl_names, names);
+	bool	thrown = false;
+	try {
+		soa.at(soa.size());
+	}
+	catch (std::out_of_range&) {
+		thrown = true;
+	}
+	check("soa_vector at", true, thrown);
+}
+
+// Copies the bits of an ft::vector<bool> into a std::vector<bool>
+std::vector<bool>	bits(const ft::vector<bool>& v) {
+	std::vector<bool>	out;
+	for (size_t i = 0; i < v.size(); i++)
+		out.push_back(v[i]);
+	return out;
+}
+
+void	vector_bool_test() {
+	ft::vector<bool>	v;
+	std::vector<bool>	stl;
+
+	srand(45);
+	for (int i = 0; i < 20000; i++) {
+		int	op = rand() % 10;
+		if (op < 5) {
+			v.push_back(rand() % 3 == 0);
+			stl.push_back(v.back());
+		}
+		else if (op == 5 && !stl.empty()) {
+			v.pop_back();
+			stl.pop_back();
+		}
+		else if (op == 6 && !stl.empty()) {
+			size_t	pos = rand() % stl.size();
+			v[pos].flip();
+			stl[pos].flip();
+		}
+		else if (op == 7 && i % 8 == 0) {
+			size_t	pos = stl.empty() ? 0 : rand() % stl.size();
+			size_t	n = rand() % 150;
+			v.insert(v.begin() + pos, n, i % 2 == 0);
+			stl.insert(stl.begin() + pos, n, i % 2 == 0);
+		}
+		else if (op == 8 && i % 8 == 0 && !stl.empty()) {
+			size_t	from = rand() % stl.size();
+			size_t	to = from + rand() % (stl.size() - from + 1);
+			v.erase(v.begin() + from, v.begin() + to);
+			stl.erase(stl.begin() + from, stl.begin() + to);
+		}
+		else if (op == 9 && i % 256 == 0) {
+			v.resize(stl.size() + 70, true);
+			stl.resize(stl.size() + 70, true);
+		}
+	}
+	check("vector<bool> push/pop/flip/insert/erase/resize", stl, bits(v));
+	size_t				set = std::count(stl.begin(), stl.end(), true);
+	std::vector<size_t>	found, stl_found;
+	for (size_t pos = v.find_first(); pos < v.size(); pos = v.find_next(pos))
+		found.push_back(pos);
+	for (size_t pos = 0; pos < stl.size(); pos++)
+		if (stl[pos])
+			stl_found.push_back(pos);
+	check("vector<bool> count", set, v.count());
+	check("vector<bool> find_first/find_next", stl_found, found);
+	check("vector<bool> rank", (size_t)std::count(stl.begin(), stl.begin() + stl.size() / 2, true), v.rank(v.size() / 2));
+	ft::vector<bool>	mask;
+	std::vector<bool>	stl_and, stl_or, stl_xor;
+	for (size_t i = 0; i < stl.size(); i++) {
+		mask.push_back(i % 3 == 0);
+		stl_and.push_back(stl[i] && i % 3 == 0);
+		stl_or.push_back(stl[i] || i % 3 == 0);
+		stl_xor.push_back(stl[i] != (i % 3 == 0));
+	}
+	check("vector<bool> &", stl_and, bits(v & mask));
+	check("vector<bool> |", stl_or, bits(v | mask));
+	check("vector<bool> ^", stl_xor, bits(v ^ mask));
+	v.flip();
+	stl.flip();
+	check("vector<bool> flip", stl, bits(v));
+	check("vector<bool> any/all/none", true, v.any() && !v.all() && !v.none() && ft::vector<bool>(100, true).all());
+}
+
+// Drives a ring from one thread next to a std::queue bounded by the
+// ring's capacity, returning the popped sequences and refusals
+template< typename Ring >
+void	ring_run(Ring& ring, std::vector<int>& popped, std::vector<int>& stl_popped, int& refused, int& stl_refused) {
+	std::queue<int>	stl;
+	int				chunk[40];
+
+	for (int i = 0; i < 20000; i++) {
+		int	op = rand() % 4;
+		if (op == 0) {
+			refused += !ring.try_push(i);
+			if (stl.size() < ring.capacity())
+				stl.push(i);
+			else
+				stl_refused++;
+		}
+		else if (op == 1) {
+			size_t	n = rand() % 40;
+			for (size_t j = 0; j < n; j++)
+				chunk[j] = i * 40 + j;
+			size_t	pushed = ring.try_push_n(chunk, n);
+			size_t	room = std::min(n, ring.capacity() - stl.size());
+			for (size_t j = 0; j < room; j++)
+				stl.push(chunk[j]);
+			refused += n - pushed;
+			stl_refused += n - room;
+		}
+		else if (op == 2) {
+			int	x;
+			if (ring.try_pop(x))
+				popped.push_back(x);
+			if (!stl.empty()) {
+				stl_popped.push_back(stl.front());
+				stl.pop();
+			}
+		}
+		else {
+			size_t	n = ring.try_pop_n(chunk, rand() % 40);
+			popped.insert(popped.end(), chunk, chunk + n);
+			for (size_t j = 0; j < n && !stl.empty(); j++) {
+				stl_popped.push_back(stl.front());
+				stl.pop();
+			}
+		}
+	}
+	while (!stl.empty()) {
+		stl_popped.push_back(stl.front());
+		stl.pop();
+	}
+	for (int x; ring.try_pop(x); )
+		popped.push_back(x);
+}
+
+void	ring_test() {
+	ft::spsc_ring<int>	spsc(100);
+	ft::mpmc_ring<int>	mpmc(100);
+	std::vector<int>	popped, stl_popped;
+	int					refused = 0, stl_refused = 0;
+
+	srand(46);
+	ring_run(spsc, popped, stl_popped, refused, stl_refused);
+	check("spsc_ring FIFO order", stl_popped, popped);
+	check("spsc_ring refusals when full", stl_refused, refused);
+	check("spsc_ring empty", true, spsc.empty() && spsc.capacity() == 128);
+	popped.clear();
+	stl_popped.clear();
+	refused = 0;
+	stl_refused = 0;
+	ring_run(mpmc, popped, stl_popped, refused, stl_refused);
+	check("mpmc_ring FIFO order", stl_popped, popped);
+	check("mpmc_ring refusals when full", stl_refused, refused);
+	check("mpmc_ring empty", true, mpmc.empty() && mpmc.capacity() == 128);
+}
+
+void	segmented_vector_test() {
+	ft::segmented_vector<std::string>			sv;
+	std::vector<std::string>					stl;
+	ft::segmented_vector<std::string>::iterator	first = sv.begin();
+	const std::string							*tenth = NULL;
+
+	srand(50);
+	for (int i = 0; i < 20000; i++) {
+		int	op = rand() % 8;
+		if (op < 5) {
+			sv.push_back(std::string(i % 11, 'a' + i % 26));
+			stl.push_back(std::string(i % 11, 'a' + i % 26));
+		}
+		else if (op < 7 && stl.size() > 11) {
+			sv.pop_back();
+			stl.pop_back();
+		}
+		else if (op == 7 && stl.size() > 10) {
+			size_t	pos = rand() % stl.size();
+			sv[pos] += "!";
+			stl[pos] += "!";
+		}
+		if (tenth == NULL && sv.size() > 10)
+			tenth = &sv[10];
+	}
+	check("segmented_vector push_back/pop_back", stl, contents(sv));
+	check("segmented_vector keeps iterators and pointers", true, *first == stl[0] && tenth == &sv[10]);
+	check("segmented_vector reverse", std::vector<std::string>(stl.rbegin(), stl.rend()),
+		std::vector<std::string>(sv.rbegin(), sv.rend()));
+	sv.resize(100);
+	stl.resize(100);
+	sv.shrink_to_fit();
+	ft::segmented_vector<std::string>	copy(sv), assigned;
+	assigned = copy;
+	copy.resize(300, "z");
+	stl.resize(300, "z");
+	check("segmented_vector resize and copy", stl, contents(copy));
+	for (size_t cap = copy.capacity(); copy.size() <= cap; ) {
+		copy.push_back(copy[copy.size() / 2]);
+		stl.push_back(stl[stl.size() / 2]);
+	}
+	check("segmented_vector push_back of its own element", stl, contents(copy));
+	check("segmented_vector operator=", true, assigned == sv && assigned < copy);
+	bool	thrown = false;
+	try {
+		sv.at(sv.size());
+	}
+	catch (std::out_of_range&) {
+		thrown = true;
+	}
+	check("segmented_vector at", true, thrown);
+}
+
+struct has_vowel_start {
+	bool	operator()(const std::string& x) const { return !x.empty() && strchr("aeiou", x[0]) != NULL; }
+};
+
+// The words of i, for vectors of strings that are not trivially copyable
+std::string	word(int i) {
+	return std::string(1 + i % 5, 'a' + i % 26) + std::string(i % 3 * 8, 'x');
+}
+
+void	erase_test() {
+	ft::vector<std::string>		v;
+	std::vector<std::string>	stl;
+
+	srand(49);
+	for (int i = 0; i < 2000; i++) {
+		v.push_back(word(i));
+		stl.push_back(word(i));
+	}
+	for (int i = 0; i < 200; i++) {
+		size_t	from = rand() % (stl.size() + 1);
+		size_t	to = from + rand() % (std::min<size_t>(stl.size() - from, 8) + 1);
+		ft::vector<std::string>::iterator	ret = v.erase(v.begin() + from, v.begin() + to);
+		stl.erase(stl.begin() + from, stl.begin() + to);
+		if (ret != v.begin() + from)
+			std::cout << "erase(first, last) return " << equal(true, false) << std::endl;
+	}
+	check("erase(first, last), empty ranges included", stl, contents(v));
+
+	size_t	erased = ft::erase_if(v, has_vowel_start());
+	size_t	stl_erased = stl.size();
+	stl.erase(std::remove_if(stl.begin(), stl.end(), has_vowel_start()), stl.end());
+	stl_erased -= stl.size();
+	check("erase_if", stl, contents(v));
+	check("erase_if count", stl_erased, erased);
+
+	std::vector<size_t>	indices;
+	indices.push_back(0);
+	for (int i = 0; i < 100; i++)
+		indices.push_back(rand() % stl.size());
+	indices.push_back(stl.size() - 1);
+	indices.push_back(stl.size() - 1);
+	std::sort(indices.begin(), indices.end());
+	std::vector<std::string>	kept;
+	for (size_t i = 0, j = 0; i < stl.size(); i++) {
+		while (j < indices.size() && indices[j] < i)
+			j++;
+		if (j == indices.size() || indices[j] != i)
+			kept.push_back(stl[i]);
+	}
+	erased = ft::erase_indices(v, indices.begin(), indices.end());
+	check("erase_indices with repeats, first and last", kept, contents(v));
+	check("erase_indices count", stl.size() - kept.size(), erased);
+	check("erase_indices of no index", size_t(0), ft::erase_indices(v, indices.begin(), indices.begin()));
+
+	std::vector<size_t>	bad;
+	bad.push_back(1);
+	bad.push_back(v.size());
+	bool	out_of_range = false;
+	try {
+		ft::erase_indices(v, bad.begin(), bad.end());
+	}
+	catch (std::out_of_range&) {
+		out_of_range = true;
+	}
+	bad[1] = 0;
+	bool	unsorted = false;
+	try {
+		ft::erase_indices(v, bad.begin(), bad.end());
+	}
+	catch (std::invalid_argument&) {
+		unsorted = true;
+	}
+	check("erase_indices refusals", true, out_of_range && unsorted);
+	check("erase_indices refusals leave the vector unchanged", kept, contents(v));
+}
+
+
+struct triple_plus_one {
+	void	operator()(long& x) const { x = x * 3 + 1; }
+};
+
+struct multiple_of {
+	long	d;
+	bool	operator()(long x) const { return x % d == 0; }
+};
+
+// Runs every parallel algorithm on 1, 2, 3 and 8 threads with several
+// grains, over an empty range, one shorter than the grains and a long one
+void	parallel_algorithm_test() {
+	size_t	threads[] = { 1, 2, 3, 8 };
+	size_t	grains[] = { 0, 1, 13, 4096 };
+	size_t	sizes[] = { 0, 7, 10007 };
+	std::vector<long>			stl_sums, sums;
+	std::vector<std::string>	stl_words, words;
+	std::vector<long>			stl_counts, counts;
+	std::vector<long>			stl_found, found;
+	bool						each = true, scan = true, scan_in_place = true;
+
+	srand(27);
+	for (size_t t = 0; t < 4; t++) {
+		ft::thread_pool	pool(threads[t]);
+		for (size_t s = 0; s < 3; s++) {
+			std::vector<long>			stl;
+			std::vector<std::string>	letters;
+			for (size_t i = 0; i < sizes[s]; i++) {
+				stl.push_back(rand() % 1000 + 1);
+				letters.push_back(std::string(1, 'a' + rand() % 26));
+			}
+			for (size_t g = 0; g < 4; g++) {
+				ft::vector<long>	v(stl.begin(), stl.end());
+				std::vector<long>	stl_each(stl);
+				std::for_each(stl_each.begin(), stl_each.end(), triple_plus_one());
+				ft::for_each(pool, v.begin(), v.end(), triple_plus_one(), grains[g]);
+				each = each && contents(v) == stl_each;
+
+				stl_sums.push_back(std::accumulate(stl_each.begin(), stl_each.end(), 0L));
+				sums.push_back(ft::reduce(pool, v.begin(), v.end(), 0L, std::plus<long>(), grains[g]));
+				stl_words.push_back(std::accumulate(letters.begin(), letters.end(), std::string(">")));
+				words.push_back(ft::reduce(pool, letters.begin(), letters.end(), std::string(">"),
+											std::plus<std::string>(), grains[g]));
+
+				std::vector<long>	stl_scan(stl.size()), out(stl.size());
+				std::partial_sum(stl.begin(), stl.end(), stl_scan.begin());
+				ft::inclusive_scan(pool, stl.begin(), stl.end(), out.begin(), std::plus<long>(), grains[g]);
+				scan = scan && out == stl_scan;
+				v.assign(stl.begin(), stl.end());
+				ft::inclusive_scan(pool, v.begin(), v.end(), v.begin(), std::plus<long>(), grains[g]);
+				scan_in_place = scan_in_place && contents(v) == stl_scan;
+
+				for (long d = 7; d <= 1001; d += 994) {
+					multiple_of	pred = { d };
+					stl_counts.push_back(std::count_if(stl.begin(), stl.end(), pred));
+					counts.push_back(ft::count_if(pool, stl.begin(), stl.end(), pred, grains[g]));
+					stl_found.push_back(std::find_if(stl.begin(), stl.end(), pred) - stl.begin());
+					found.push_back(ft::find_if(pool, stl.begin(), stl.end(), pred, grains[g]) - stl.begin());
+				}
+			}
+		}
+	}
+	check("parallel for_each", true, each);
+	check("parallel reduce", stl_sums, sums);
+	check("parallel reduce keeps the order", stl_words, words);
+	check("parallel inclusive_scan", true, scan);
+	check("parallel inclusive_scan in place", true, scan_in_place);
+	check("parallel count_if", stl_counts, counts);
+	check("parallel find_if finds the first match", stl_found, found);
+}
+
+
+// Index of the first mismatch from one kernel level, bytes go through
+// the byte kernels and floats through the IEEE ones
+template< typename T >
+size_t	simd_kernel(int level, const T *a, const T *b, size_t n) {
+	const unsigned char	*x = reinterpret_cast<const unsigned char *>(a);
+	const unsigned char	*y = reinterpret_cast<const unsigned char *>(b);
+
+#ifdef FT_SIMD_X86
+	if (level == ft::simd::AVX2)
+		return ft::simd::mismatch_bytes_avx2(x, y, n);
+	if (level == ft::simd::SSE2)
+		return ft::simd::mismatch_bytes_sse2(x, y, n);
+#endif
+	(void)level;
+	return ft::simd::mismatch_bytes_scalar(x, y, n);
+}
+
+template< typename T >
+size_t	simd_float_kernel(int level, const T *a, const T *b, size_t n) {
+#ifdef FT_SIMD_X86
+	if (level == ft::simd::AVX2)
+		return ft::simd::mismatch_avx2(a, b, n);
+	if (level == ft::simd::SSE2)
+		return ft::simd::mismatch_sse2(a, b, n);
+#endif
+	(void)level;
+	return ft::simd::mismatch(a, b, n);
+}
+
+size_t	simd_kernel(int level, const float *a, const float *b, size_t n) { return simd_float_kernel(level, a, b, n); }
+size_t	simd_kernel(int level, const double *a, const double *b, size_t n) { return simd_float_kernel(level, a, b, n); }
+
+// Pairs of arrays of every length up to 80 built from a few values, equal,
+// differing at one spot or of different lengths, through ft::equal,
+// ft::lexicographical_compare and every kernel the CPU runs
+template< typename T >
+void	simd_run(const std::string& name, const T *values, size_t n_values) {
+	std::vector<bool>	stl_equal, ft_equal, stl_less, ft_less;
+	std::vector<size_t>	stl_at, at;
+
+	for (size_t len = 0; len <= 80; len++) {
+		for (int trial = 0; trial < 20; trial++) {
+			ft::vector<T>	a, b;
+			for (size_t i = 0; i < len; i++)
+				a.push_back(values[rand() % n_values]);
+			b = a;
+			if (trial % 4 != 0 && len != 0)
+				b[rand() % len] = values[rand() % n_values];
+			if (trial % 4 == 3)
+				b.resize(len + rand() % 3 - (len != 0), values[0]);
+			std::vector<T>	sa = contents(a), sb = contents(b);
+			size_t			n = std::min(a.size(), b.size());
+
+			stl_equal.push_back(std::equal(sa.begin(), sa.begin() + n, sb.begin()));
+			ft_equal.push_back(ft::equal(a.begin(), a.begin() + n, b.begin()));
+			stl_less.push_back(std::lexicographical_compare(sa.begin(), sa.end(), sb.begin(), sb.end()));
+			ft_less.push_back(ft::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end()));
+			for (int level = 0; level <= ft::simd::cpu_level(); level++) {
+				stl_at.push_back(std::mismatch(sa.begin(), sa.begin() + n, sb.begin()).first - sa.begin());
+				at.push_back(simd_kernel(level, a.data(), b.data(), n));
+			}
+		}
+	}
+	check("simd equal " + name, stl_equal, ft_equal);
+	check("simd lexicographical_compare " + name, stl_less, ft_less);
+	check("simd mismatch kernels " + name, stl_at, at);
+}
+
+void	simd_test() {
+	signed char		schars[] = { -128, -1, 0, 1, 127 };
+	unsigned char	uchars[] = { 0, 1, 127, 128, 255 };
+	float			floats[] = { 0.0f, -0.0f, 1.0f, -1.0f, NAN, INFINITY };
+	double			doubles[] = { 0.0, -0.0, 1.0, -1.0, NAN, -INFINITY };
+
+	srand(28);
+	simd_run("signed char", schars, 5);
+	simd_run("unsigned char", uchars, 5);
+	simd_run("float", floats, 6);
+	simd_run("double", doubles, 6);
+}
+
+// std::allocator carrying an id, to see which allocator a vector holds
+template< typename T >
+struct tagged_allocator : public std::allocator<T> {
+	int	id;
+
+	template< typename U >
+	struct rebind { typedef tagged_allocator<U> other; };
+
+	tagged_allocator(int n = 0) : id(n) { }
+	template< typename U >
+	tagged_allocator(const tagged_allocator<U>& other) : id(other.id) { }
+};
+
+void	assign_swap_test() {
+	typedef ft::vector<std::string, tagged_allocator<std::string> >	tagged_vector;
+	ft::vector<std::string>	v, small;
+
+	for (int i = 0; i < 100; i++)
+		v.push_back(word(i));
+	for (int i = 0; i < 10; i++)
+		small.push_back(word(i + 500));
+	std::vector<std::string>	kept = contents(v);
+	ft::vector<std::string>&	alias = v;
+	v = alias;
+	check("operator= to itself", kept, contents(v));
+
+	size_t				cap = v.capacity();
+	const std::string	*data = v.data();
+	v = small;
+	check("operator= from a smaller vector", contents(small), contents(v));
+	check("operator= keeps the buffer", true, v.capacity() == cap && v.data() == data);
+	v = ft::vector<std::string>(kept.begin(), kept.end());
+	check("operator= from a larger vector", kept, contents(v));
+
+	tagged_vector	a(tagged_allocator<std::string>(1)), b(tagged_allocator<std::string>(2));
+	for (int i = 0; i < 50; i++)
+		a.push_back(word(i));
+	b.push_back(word(1000));
+	const std::string	*in_a = &a[10];
+	std::vector<std::string>	stl_a = contents(a), stl_b = contents(b);
+	ft::swap(a, b);
+	check("ft::swap exchanges contents", stl_a, contents(b));
+	check("ft::swap exchanges contents back", stl_b, contents(a));
+	check("ft::swap moves the buffer", true, in_a == &b[10] && *in_a == stl_a[10]);
+	check("ft::swap exchanges allocators", true, a.get_allocator().id == 2 && b.get_allocator().id == 1);
+	check("has_member_swap", true, ft::has_member_swap<ft::vector<int> >::value
+									&& ft::has_member_swap<tagged_vector>::value
+									&& !ft::has_member_swap<std::string *>::value
+									&& !ft::has_member_swap<tagged_allocator<int> >::value);
+
+	int	x = 1, y = 2;
+	ft::swap(x, y);
+	check("ft::swap without a member swap", true, x == 2 && y == 1);
+}
+
+// One producer or consumer thread of ring_threads_run. Producers push
+// id * count + i for i in [0, count) in chunks of 1 to 8; consumers pop
+// up to 8 at a time until they get a -1, handing back any extra -1.
+template< typename Ring >
+struct ring_thread {
+	Ring				*ring;
+	int					id;
+	int					count;
+	std::vector<int>	popped;
+
+	static void	*produce(void *p) {
+		ring_thread	*t = static_cast<ring_thread *>(p);
+		int			chunk[8];
+
+		for (int i = 0; i < t->count; ) {
+			int	n = std::min(1 + i % 8, t->count - i);
+			for (int j = 0; j < n; j++)
+				chunk[j] = t->id * t->count + i + j;
+			t->ring->push_n(chunk, n);
+			i += n;
+		}
+		return NULL;
+	}
+
+	static void	*consume(void *p) {
+		ring_thread	*t = static_cast<ring_thread *>(p);
+		int			chunk[8];
+
+		for (bool done = false; !done; ) {
+			size_t	n = t->ring->pop_n(chunk, 1 + t->popped.size() % 8);
+			for (size_t j = 0; j < n; j++) {
+				if (chunk[j] >= 0)
+					t->popped.push_back(chunk[j]);
+				else if (done)
+					t->ring->push(-1);
+				else
+					done = true;
+			}
+		}
+		return NULL;
+	}
+};
+
+// Each value must be popped exactly once, and a consumer must see the
+// values of one producer in the order they were pushed
+template< typename Ring >
+void	ring_threads_run(const std::string& name, int producers, int consumers) {
+	Ring								ring(64);
+	std::vector<ring_thread<Ring> >		threads(producers + consumers);
+	std::vector<pthread_t>				ids(producers + consumers);
+	std::vector<int>					all, expected;
+	bool								ordered = true;
+
+	for (int i = 0; i < producers + consumers; i++) {
+		threads[i].ring = &ring;
+		threads[i].id = i;
+		threads[i].count = 20000;
+		pthread_create(&ids[i], NULL, i < producers ? ring_thread<Ring>::produce : ring_thread<Ring>::consume, &threads[i]);
+	}
+	for (int i = 0; i < producers; i++)
+		pthread_join(ids[i], NULL);
+	for (int i = 0; i < consumers; i++)
+		ring.push(-1);
+	for (int i = producers; i < producers + consumers; i++) {
+		std::vector<int>	last(producers, -1);
+		pthread_join(ids[i], NULL);
+		for (size_t j = 0; j < threads[i].popped.size(); j++) {
+			int	x = threads[i].popped[j];
+			ordered = ordered && x > last[x / 20000];
+			last[x / 20000] = x;
+		}
+		all.insert(all.end(), threads[i].popped.begin(), threads[i].popped.end());
+	}
+	for (int i = 0; i < producers * 20000; i++)
+		expected.push_back(i);
+	std::sort(all.begin(), all.end());
+	check(name + " pops every value once", expected, all);
+	check(name + " keeps each producer's order", true, ordered);
+	check(name + " empty", true, ring.empty());
+}
+
+void	ring_threads_test() {
+	ring_threads_run<ft::spsc_ring<int, ft::futex_wait> >("spsc_ring futex_wait 1x1", 1, 1);
+	ring_threads_run<ft::mpmc_ring<int> >("mpmc_ring 4x4", 4, 4);
+	ring_threads_run<ft::mpmc_ring<int, ft::futex_wait> >("mpmc_ring futex_wait 4x4", 4, 4);
+}
 
 int	main(int argc, char **argv) {
 	if (argc == 2 && strcmp(argv[1], "time")) {
@@ -246,6 +1109,18 @@ int	main(int argc, char **argv) {
 	relational_operators_test();
 	testVstresstest();
 	sam();
+	deque_test();
+	adaptors_test();
+	mapped_vector_test();
+	soa_vector_test();
+	vector_bool_test();
+	ring_test();
+	segmented_vector_test();
+	erase_test();
+	parallel_algorithm_test();
+	simd_test();
+	assign_swap_test();
+	ring_threads_test();
 	if (argc == 2 && strcmp(argv[1], "time")) {
 		gettimeofday(&tv, NULL);
 		endtime = tv.tv_usec;
@@ -6,14 +6,17 @@
 /*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/12/09 00:27:08 by moabid            #+#    #+#             */
-/*   Updated: 2022/12/13 23:25:22 by moabid           ###   ########.fr       */
+/*   Updated: 2026/10/22 11:01:36 by moabid           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #pragma once
 
 # include <stdexcept>
+# include <utility>
 # include "iterators/tree.hpp"
+# include "vector.hpp"
+# include "iterators/node_handle.hpp"
 
 namespace ft
 {
@@ -44,17 +47,49 @@ namespace ft
     * - Modifiers:
     * assign:               Assign map content
     * insert:               Insert elements
+    * assign_sorted:        Assign sorted elements in linear time
+    * insert_batch:         Insert unsorted elements in one sorted pass
     * erase:                Erase elements
     * swap:                 Swap content
     * clear:                Clear content
+    * extract:              Take a node out of the map
+    * merge:                Move in the nodes of another map
+    *
+    * - Set algebra:
+    * set_union:            Move in the entries of another map
+    * set_intersection:     Keep the keys also in another map
+    * set_difference:       Remove the keys found in another map
+    * split:                Move the keys from a bound on into another map
+    * join:                 Append a map of greater keys
+    * partition:            Cut into ordered subranges of equal size
+    *
+    * - Lookup:
+    * find_batch:           Find many keys, their descents interleaved
+    * count_batch:          Count many keys, their descents interleaved
+    *
+    * - Statistics:
+    * shape:                Height, black-height and nodes per depth
+    * stats:                Operation counters (FT_TREE_STATS builds only)
+    * reset_stats:          Zero the operation counters
     *
     * - Non-member function overloads:
     * relational operators: Relational operators for map
     * swap:                 Exchange contents of two maps
+    *
+    * - Threaded (last template parameter, false by default):
+    * Every node also links to its in-order neighbours, so iterator
+    * steps are one pointer load instead of a climb through parents.
+    * Costs two pointers per node and a few stores per insert/erase.
+    *
+    * - Node transfers (insert of a node handle, merge, set_union,
+    * split, join) move nodes between maps without copying them, so
+    * both sides must have equal allocators: std::invalid_argument
+    * otherwise. Copy the entries with insert to cross allocators.
     * ------------------------------------------------------------- *
     */
    
-	template<class Key, class T, class Compare = std::less<Key>, class Allocator = std::allocator<ft::pair<const Key, T> > >
+	template<class Key, class T, class Compare = std::less<Key>, class Allocator = std::allocator<ft::pair<const Key, T> >,
+				bool Threaded = false>
 	class map
 	{
 		public:
@@ -89,11 +124,13 @@ namespace ft
 					}
 			};
 		
-			typedef	ft::tree<value_type, value_compare, allocator_type>		tree;
+			typedef	ft::tree<value_type, value_compare, allocator_type, Threaded>	tree;
 			typedef	typename tree::iterator									iterator;
 			typedef	typename tree::const_iterator							const_iterator;
 			typedef	typename tree::reverse_iterator							reverse_iterator;
 			typedef	typename tree::const_reverse_iterator					const_reverse_iterator;
+			typedef	ft::map_node_handle<Key, T, Allocator, Threaded>		node_type;
+			typedef	ft::node_insert_return<iterator, node_type>				insert_return_type;
 		
 		private:
     	    /* ------------------------------------------------------------- */
@@ -150,14 +187,14 @@ namespace ft
 
             /* ------------------------------------------------------------- */
             /**
-            *   Assigns a map to this vecto using the assign method.
+            *   Assigns a map to this vecto using the assign method. The
+            *   allocator of *this is kept, the entries are copied into it.
             *   
             *   @param x        The map that will be assigned.
             */
             /* ------------------------------------------------------------- */
 
 			map& operator= (const map& x) {
-				_alloc = x.get_allocator();
 				_comp = x.key_comp();
 				_tree = x._tree;
 				return *this;
@@ -179,7 +216,7 @@ namespace ft
             /* ------------------------------------------------------------- */
 			
 			mapped_type& at (const key_type& k) {
-				Node<value_type>* tmp = _tree.find(ft::make_pair(k, mapped_type()));
+				typename tree::pointer tmp = _tree.find(ft::make_pair(k, mapped_type()));
 				if (tmp == nullptr)
 					throw std::out_of_range("ft::map::at");
 				return (tmp->value.second);
@@ -188,7 +225,7 @@ namespace ft
             /* ------------------------------------------------------------- */
 			
 			const mapped_type& at (const key_type& k) const {
-				Node<value_type>* tmp = _tree.find(ft::make_pair(k, mapped_type()));
+				typename tree::pointer tmp = _tree.find(ft::make_pair(k, mapped_type()));
 				if (tmp == nullptr)
 					throw std::out_of_range("ft::map::at");
 				return (tmp->value.second);
@@ -296,6 +333,82 @@ namespace ft
 				for (; first != last; first++)
 					insert(*first);
 			}
+
+			/* ------------------------------------------------------------- */
+			/**
+			*   Replaces the content with [first, last), in linear time when
+			*   the keys come in increasing order (a sorted dump, a snapshot).
+			*   Out of order entries are still inserted, in O(log n) each.
+			*/
+			/* ------------------------------------------------------------- */
+
+			template <class InputIterator>
+			void assign_sorted (InputIterator first, InputIterator last) { _tree.assign_sorted(first, last); }
+
+			/* ------------------------------------------------------------- */
+			/**
+			*   Inserts a batch of entries in any order: the batch is sorted
+			*   and merged into the tree in one ascending pass, each search
+			*   starting from the previous insertion point, or, for a batch
+			*   large next to the map, merged and rebuilt in O(n + m).
+			*   Like insert, existing keys and repeats keep their first value.
+			*   Iterators to the new entries go to inserted, in key order.
+			*/
+			/* ------------------------------------------------------------- */
+
+			template <class InputIterator, class OutputIterator>
+			OutputIterator insert_batch (InputIterator first, InputIterator last, OutputIterator inserted) {
+				ft::vector<typename tree::pointer>	nodes;
+
+				_tree.insert_batch(first, last, nodes);
+				for (size_type i = 0; i < nodes.size(); i++, ++inserted)
+					*inserted = iterator(nodes[i]);
+				return inserted;
+			}
+				// Returns the number of new entries
+			template <class InputIterator>
+			size_type insert_batch (InputIterator first, InputIterator last) {
+				ft::vector<typename tree::pointer>	nodes;
+
+				_tree.insert_batch(first, last, nodes);
+				return nodes.size();
+			}
+
+			/* ------------------------------------------------------------- */
+			/**
+			*   Node handle insertion, links the node of nh without any
+			*   allocation or copy. On a key collision nh is moved into the
+			*   returned node member and the map is unchanged.
+			*/
+			/* ------------------------------------------------------------- */
+
+			insert_return_type insert (node_type&& nh) {
+				insert_return_type	ret;
+
+				ret.inserted = false;
+				ret.position = end();
+				if (nh.empty())
+					return ret;
+				if (!(nh.get_allocator() == _alloc))
+					throw std::invalid_argument("ft::map");
+				typename tree::pointer	found = _tree.insert_node(nh._node);
+
+				ret.position = iterator(found);
+				if (found == nh._node) {
+					nh._take();
+					ret.inserted = true;
+				}
+				else
+					ret.node = std::move(nh);
+				return ret;
+			}
+
+			/* ------------------------------------------------------------- */
+
+			iterator insert (iterator position, node_type&& nh) {
+				(void)position;
+				return insert(std::move(nh)).position;
+			}
 			
 			/* ------------------------------------------------------------- */
 
@@ -311,12 +424,143 @@ namespace ft
 				while (first != last)
 					erase(first++);
 			}
+
+			/* ------------------------------------------------------------- */
+			/**
+			*   Extract, unlinks an element and returns it in a node handle,
+			*   to be inserted again, possibly under another key, or into
+			*   another map. Returns an empty handle if k is not found.
+			*/
+			/* ------------------------------------------------------------- */
+
+			node_type extract (iterator position) {
+				return node_type(_tree.extract(position.base()), _alloc);
+			}
+
+			/* ------------------------------------------------------------- */
+
+			node_type extract (const key_type& k) {
+				typename tree::pointer	found = _tree.find(ft::make_pair(k, mapped_type()));
+
+				if (found == nullptr)
+					return node_type();
+				return node_type(_tree.extract(found), _alloc);
+			}
+
+			/* ------------------------------------------------------------- */
+			/**
+			*   Merge, splices every node of source whose key is not in this
+			*   map; the others stay in source. No allocation or copy.
+			*/
+			/* ------------------------------------------------------------- */
+
+			void merge (map& source) { _tree.merge(source._tree); }
 			
 			/* ------------------------------------------------------------- */
 			
 			void swap (map& x) {
+				ft::swap(_comp, x._comp);
+				ft::swap(_alloc, x._alloc);
 				_tree.swap(x._tree);
 			}
+
+			/* ------------------------------------------------------------- */
+			/**
+			*   Set algebra. Union and intersection split and join the trees
+			*   in O(m log(n / m + 1)) for sizes m <= n, difference runs in
+			*   O(m + n) or in O(m log n) when one map is much smaller; the
+			*   threaded maps use the latter for all three. Entries are moved
+			*   between the maps, never copied.
+			*   resolve(mine, theirs) receives both value_type of a key present
+			*   in the two maps and may update mine.second, by default mine wins.
+			*
+			*   @param x        The other map, emptied by set_union.
+			*/
+			/* ------------------------------------------------------------- */
+
+			template <class Resolve>
+			void set_union (map& x, Resolve resolve) { _tree.set_union(x._tree, resolve); }
+			void set_union (map& x) { _tree.set_union(x._tree); }
+
+			/* ------------------------------------------------------------- */
+
+			template <class Resolve>
+			void set_intersection (const map& x, Resolve resolve) { _tree.set_intersection(x._tree, resolve); }
+			void set_intersection (const map& x) { _tree.set_intersection(x._tree); }
+
+			/* ------------------------------------------------------------- */
+
+			void set_difference (const map& x) { _tree.set_difference(x._tree); }
+
+			/* ------------------------------------------------------------- */
+			/**
+			*   Split and join in O(log n), no entry is copied or reallocated.
+			*   split leaves the keys below k here and moves the others to
+			*   upper; both sizes stay exact, every node knows the size of its
+			*   subtree. join appends upper, whose keys must all be
+			*   greater than the keys of this map, and empties it.
+			*
+			*   @param k        The first key moved to upper.
+			*   @param upper    The map receiving, or giving, the greater keys.
+			*/
+			/* ------------------------------------------------------------- */
+
+			void split (const key_type& k, map& upper) { _tree.split(ft::make_pair(k, mapped_type()), upper._tree); }
+
+			/* ------------------------------------------------------------- */
+
+			void join (map& upper) { _tree.join(upper._tree); }
+
+			/* ------------------------------------------------------------- */
+			/**
+			*   Cuts [first, last) into at most k ordered subranges whose sizes
+			*   differ by one at most, picked by rank in O(k log n).
+			*   Returns the bounds, first and last included: subrange i is
+			*   [bounds[i], bounds[i + 1]). Meant for parallel traversals, see
+			*   the ordered range overloads in parallel_algorithm.hpp.
+			*/
+			/* ------------------------------------------------------------- */
+
+			ft::vector<iterator> partition (iterator first, iterator last, size_type k) {
+				ft::vector<typename tree::pointer>	inner;
+				ft::vector<iterator>				bounds;
+
+				_tree.partition(first.base(), last.base(), k, inner);
+				bounds.reserve(inner.size() + 2);
+				bounds.push_back(first);
+				for (size_type i = 0; i < inner.size(); i++)
+					bounds.push_back(iterator(inner[i]));
+				bounds.push_back(last);
+				return bounds;
+			}
+			ft::vector<const_iterator> partition (const_iterator first, const_iterator last, size_type k) const {
+				ft::vector<typename tree::pointer>	inner;
+				ft::vector<const_iterator>			bounds;
+
+				_tree.partition(const_cast<typename tree::pointer>(first.base()),
+								const_cast<typename tree::pointer>(last.base()), k, inner);
+				bounds.reserve(inner.size() + 2);
+				bounds.push_back(first);
+				for (size_type i = 0; i < inner.size(); i++)
+					bounds.push_back(const_iterator(inner[i]));
+				bounds.push_back(last);
+				return bounds;
+			}
+			ft::vector<iterator> partition (size_type k) { return partition(begin(), end(), k); }
+			ft::vector<const_iterator> partition (size_type k) const { return partition(begin(), end(), k); }
+
+			/* ------------------------------------------------------------- */
+			/**
+			*   Statistics: counters need FT_TREE_STATS for the whole
+			*   program, the shape walk is always there
+			*/
+			/* ------------------------------------------------------------- */
+
+# ifdef FT_TREE_STATS
+			ft::tree_stats stats () const { return _tree.stats(); }
+			void reset_stats () { _tree.reset_stats(); }
+# endif
+			ft::tree_shape shape () const { return _tree.shape(); }
    			
 			/* ------------------------------------------------------------- */
    			/**
@@ -333,6 +577,66 @@ namespace ft
 			iterator find (const key_type& k) { return iterator(_tree.iter_find(ft::make_pair(k, mapped_type()))); }
 			const_iterator find (const key_type& k) const { return const_iterator(_tree.iter_find(ft::make_pair(k, mapped_type()))); }
 			
+			/* ------------------------------------------------------------- */
+			/**
+			*   Batched lookups: one result per key, in order, through out.
+			*   The descents of up to 32 keys are interleaved with prefetches
+			*   so that their cache misses overlap; worth it on maps larger
+			*   than the caches, for batches of a few dozen keys and up.
+			*/
+			/* ------------------------------------------------------------- */
+
+			template <class InputIterator, class OutputIterator>
+			OutputIterator find_batch (InputIterator first, InputIterator last, OutputIterator out) {
+				typename tree::pointer	nodes[_batch_chunk];
+				ft::vector<value_type>	keys;
+
+				while (first != last) {
+					size_type	n = _batch_keys(first, last, keys);
+
+					_tree.find_batch(keys.data(), n, nodes);
+					for (size_type i = 0; i < n; i++, ++out)
+						*out = nodes[i] ? iterator(nodes[i]) : end();
+				}
+				return out;
+			}
+			template <class InputIterator, class OutputIterator>
+			OutputIterator find_batch (InputIterator first, InputIterator last, OutputIterator out) const {
+				typename tree::pointer	nodes[_batch_chunk];
+				ft::vector<value_type>	keys;
+
+				while (first != last) {
+					size_type	n = _batch_keys(first, last, keys);
+
+					_tree.find_batch(keys.data(), n, nodes);
+					for (size_type i = 0; i < n; i++, ++out)
+						*out = nodes[i] ? const_iterator(nodes[i]) : end();
+				}
+				return out;
+			}
+				// Writes count(key) for each key, returns how many were found
+			template <class InputIterator, class OutputIterator>
+			size_type count_batch (InputIterator first, InputIterator last, OutputIterator out) const {
+				typename tree::pointer	nodes[_batch_chunk];
+				ft::vector<value_type>	keys;
+				size_type				found = 0;
+
+				while (first != last) {
+					size_type	n = _batch_keys(first, last, keys);
+
+					_tree.find_batch(keys.data(), n, nodes);
+					for (size_type i = 0; i < n; i++, ++out) {
+						*out = nodes[i] != nullptr;
+						found += nodes[i] != nullptr;
+					}
+				}
+				return found;
+			}
+			template <class InputIterator>
+			size_type count_batch (InputIterator first, InputIterator last) const {
+				return count_batch(first, last, _discard());
+			}
+
 			/* ------------------------------------------------------------- */	
 
 			pair<const_iterator,const_iterator> equal_range (const key_type& k) const {
@@ -359,6 +663,28 @@ namespace ft
 
 			key_compare key_comp() const { return _comp; }
 			value_compare value_comp() const { return value_compare(_comp); }
+
+		private:
+			/* ------------------------------------------------------------- */
+			/* ------------------------ BATCH UTILS ------------------------ */
+			static const size_type	_batch_chunk = 256;
+
+				// Output iterator that drops what it is given
+			struct _discard
+			{
+				_discard&	operator*() { return *this; }
+				_discard&	operator++() { return *this; }
+				template <class U>
+				_discard&	operator=(const U&) { return *this; }
+			};
+				// Turns the next _batch_chunk keys at most into tree keys
+			template <class InputIterator>
+			static size_type	_batch_keys(InputIterator& first, InputIterator last, ft::vector<value_type>& keys) {
+				keys.clear();
+				for ( ; first != last && keys.size() < _batch_chunk; ++first)
+					keys.push_back(value_type(*first, mapped_type()));
+				return keys.size();
+			}
 	};
 
     /* ------------------------------------------------------------- */
@@ -367,35 +693,35 @@ namespace ft
     */
     /* ------------------------------------------------------------- */
 	
-	template< class Key, class T, class Compare, class Alloc >
-	bool operator==( const ft::map<Key,T,Compare,Alloc>& lhs, const ft::map<Key,T,Compare,Alloc>& rhs ) {
+	template< class Key, class T, class Compare, class Alloc, bool Threaded >
+	bool operator==( const ft::map<Key,T,Compare,Alloc,Threaded>& lhs, const ft::map<Key,T,Compare,Alloc,Threaded>& rhs ) {
 		if (lhs.size() != rhs.size())
 			return false;
 		return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
 	}
 	
-	template <class Key, class T, class Compare, class Alloc> 
-	bool operator!= ( const map<Key,T,Compare,Alloc>& lhs, const map<Key,T,Compare,Alloc>& rhs ) {
+	template <class Key, class T, class Compare, class Alloc, bool Threaded>
+	bool operator!= ( const map<Key,T,Compare,Alloc,Threaded>& lhs, const map<Key,T,Compare,Alloc,Threaded>& rhs ) {
 		return !(lhs == rhs);
 	}
 
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator< ( const map<Key,T,Compare,Alloc>& lhs, const map<Key,T,Compare,Alloc>& rhs ) {
+	template <class Key, class T, class Compare, class Alloc, bool Threaded>
+	bool operator< ( const map<Key,T,Compare,Alloc,Threaded>& lhs, const map<Key,T,Compare,Alloc,Threaded>& rhs ) {
 		return ft::lexicographical_compare (lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 	}
 
-	template <class Key, class T, class Compare, class Alloc> 
-	bool operator<= ( const map<Key,T,Compare,Alloc>& lhs, const map<Key,T,Compare,Alloc>& rhs ) {
+	template <class Key, class T, class Compare, class Alloc, bool Threaded>
+	bool operator<= ( const map<Key,T,Compare,Alloc,Threaded>& lhs, const map<Key,T,Compare,Alloc,Threaded>& rhs ) {
 		return 	!(rhs < lhs);
 	}
 
-	template <class Key, class T, class Compare, class Alloc> 
-	bool operator>  ( const map<Key,T,Compare,Alloc>& lhs, const map<Key,T,Compare,Alloc>& rhs ) {
+	template <class Key, class T, class Compare, class Alloc, bool Threaded>
+	bool operator>  ( const map<Key,T,Compare,Alloc,Threaded>& lhs, const map<Key,T,Compare,Alloc,Threaded>& rhs ) {
 		return rhs < lhs;
 	}
 	
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator>= ( const map<Key,T,Compare,Alloc>& lhs, const map<Key,T,Compare,Alloc>& rhs ) {
+	template <class Key, class T, class Compare, class Alloc, bool Threaded>
+	bool operator>= ( const map<Key,T,Compare,Alloc,Threaded>& lhs, const map<Key,T,Compare,Alloc,Threaded>& rhs ) {
 		return 	!(lhs < rhs);
 	}
 	
@@ -405,6 +731,6 @@ namespace ft
 	*/
 	/* ------------------------------------------------------------- */
 	
-	template <class Key, class T, class Compare, class Alloc>
-	void swap (map<Key,T,Compare,Alloc>& lhs, map<Key,T,Compare,Alloc>& rhs) { lhs.swap(rhs); }
+	template <class Key, class T, class Compare, class Alloc, bool Threaded>
+	void swap (map<Key,T,Compare,Alloc,Threaded>& lhs, map<Key,T,Compare,Alloc,Threaded>& rhs) { lhs.swap(rhs); }
 }
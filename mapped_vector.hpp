@@ -0,0 +1,406 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mapped_vector.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 09:06:29 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/22 14:29:24 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#pragma once
+
+# include <algorithm>
+# include <cerrno>
+# include <cstring>
+# include <limits>
+# include <stdexcept>
+# include <string>
+# include <stddef.h>
+# include <stdint.h>
+# include <fcntl.h>
+# include <unistd.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include "iterators/VectorIterator.hpp"
+# include "iterators/iterator.hpp"
+# include "algorithm.hpp"
+# include "type_traits.hpp"
+
+namespace ft
+{
+	/**
+    * ------------------------------------------------------------- *
+    * --------------------- FT::MAPPED_VECTOR --------------------- *
+    *
+    * A vector of trivially copyable T whose buffer is a shared
+    * mapping of a file: the elements live in the page cache, survive
+    * the process and are back as soon as the file is mapped again,
+    * nothing is read or parsed on open.
+    *
+    * - File layout:
+    * header:               4 KB, magic, version, sizeof(T) and the
+    *                       size as of the last sync or close
+    * elements:             From offset 4096, the file size gives the
+    *                       capacity
+    *
+    * - Files:
+    * open:                 Map a file, created empty if missing
+    * close:                Record the size and unmap
+    * is_open:              Test whether a file is mapped
+    * sync:                 Durability point, see below
+    *
+    * - Capacity:
+    * size, capacity, empty, max_size
+    * reserve:              Grow the file (ftruncate) and the mapping
+    *                       (mremap), doubling on push_back
+    * shrink_to_fit:        Truncate the file to the elements
+    *
+    * - Element access:
+    * operator[], at, front, back, data
+    *
+    * - Modifiers:
+    * push_back, pop_back, append, resize, clear, swap
+    *
+    * sync() flushes the elements with msync, then the header, so
+    * after a crash the file holds at least the elements of the last
+    * sync. Writes since then reach the file at close() or whenever
+    * the kernel writes the pages back, but the recorded size only
+    * moves at sync() and close(). Growing may move the mapping and
+    * invalidates pointers and iterators, like ft::vector.
+    * ------------------------------------------------------------- *
+    */
+
+	template <class T>
+	class mapped_vector
+	{
+		static_assert(ft::is_trivially_copyable<T>::value, "ft::mapped_vector: T must be trivially copyable");
+
+		public:
+			typedef	T										value_type;
+			typedef	size_t									size_type;
+			typedef	std::ptrdiff_t							difference_type;
+			typedef	T&										reference;
+			typedef	const T&								const_reference;
+			typedef	T*										pointer;
+			typedef	const T*								const_pointer;
+			typedef	ft::VectorIterator<value_type>			iterator;
+			typedef	ft::VectorIterator<const value_type>	const_iterator;
+			typedef	ft::reverse_iterator<iterator>			reverse_iterator;
+			typedef	ft::reverse_iterator<const_iterator>	const_reverse_iterator;
+
+		private:
+			struct header {
+				char		magic[8];
+				uint32_t	version;
+				uint32_t	elem_size;
+				uint64_t	size;
+			};
+
+			static const size_t	_header_bytes = 4096;
+			static const size_t	_min_bytes = 64 * 1024;
+
+			int			_fd;
+			char*		_map;
+			size_t		_bytes;
+			size_type	_size;
+
+			static const char	*_magic() { return "FTMAPVEC"; }
+
+		public:
+			/* ------------------------------------------------------------- */
+			/**
+			*   Constructors, the second one opens path.
+			*/
+			/* ------------------------------------------------------------- */
+
+			mapped_vector() : _fd(-1), _map(nullptr), _bytes(0), _size(0) { }
+
+			explicit mapped_vector(const char *path) : _fd(-1), _map(nullptr), _bytes(0), _size(0) {
+				open(path);
+			}
+
+			~mapped_vector() {
+				if (is_open())
+					_unmap();
+			}
+
+			/* ------------------------------------------------------------- */
+			/**
+			*   Maps path, creating it when missing. An existing file must
+			*   have been written by a mapped_vector of the same sizeof(T).
+			*/
+			/* ------------------------------------------------------------- */
+
+			void	open(const char *path) {
+				struct stat	st;
+				header*		h;
+
+				if (is_open())
+					close();
+				_fd = ::open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+				if (_fd < 0)
+					_fail("open");
+				if (fstat(_fd, &st) < 0)
+					_fail("fstat");
+				_bytes = st.st_size;
+				if (_bytes == 0) {
+					_bytes = _header_bytes + _min_bytes;
+					if (ftruncate(_fd, _bytes) < 0)
+						_fail("ftruncate");
+				}
+				else if (_bytes < _header_bytes)
+					_invalid("file too small");
+				_map = static_cast<char *>(mmap(nullptr, _bytes, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0));
+				if (_map == MAP_FAILED) {
+					_map = nullptr;
+					_fail("mmap");
+				}
+				h = _header();
+				if (st.st_size == 0) {
+					memcpy(h->magic, _magic(), sizeof(h->magic));
+					h->version = 1;
+					h->elem_size = sizeof(T);
+					h->size = 0;
+				}
+				else if (memcmp(h->magic, _magic(), sizeof(h->magic)) != 0 || h->version != 1)
+					_invalid("not a mapped_vector file");
+				else if (h->elem_size != sizeof(T))
+					_invalid("element size mismatch");
+				else if (h->size > capacity())
+					_invalid("size beyond the end of the file");
+				_size = h->size;
+			}
+
+			/* ------------------------------------------------------------- */
+			/**
+			*   Records the size in the header and unmaps, without waiting
+			*   for the pages to reach the disk (call sync() for that).
+			*/
+			/* ------------------------------------------------------------- */
+
+			void	close() {
+				if (is_open())
+					_unmap();
+			}
+
+			bool	is_open() const { return _map != nullptr; }
+
+			/* ------------------------------------------------------------- */
+			/**
+			*   Durability point: the pages of the elements, then the header,
+			*   are flushed to the file with msync. The kernel only writes
+			*   the dirty ones, so elements written in place are covered. A
+			*   failure throws but leaves the file open.
+			*/
+			/* ------------------------------------------------------------- */
+
+			void	sync() {
+				size_t	page;
+				size_t	from;
+				size_t	to;
+
+				if (!is_open())
+					return ;
+				page = sysconf(_SC_PAGESIZE);
+				from = _header_bytes / page * page;
+				to = _header_bytes + _size * sizeof(T);
+				if (to > from && msync(_map + from, to - from, MS_SYNC) < 0)
+					_error("msync");
+				_header()->size = _size;
+				if (msync(_map, _header_bytes, MS_SYNC) < 0)
+					_error("msync");
+			}
+
+			/* ------------------------------------------------------------- */
+			/**
+			*   Capacity
+			*/
+			/* ------------------------------------------------------------- */
+
+			size_type	size() const { return _size; }
+			size_type	capacity() const { return _bytes < _header_bytes ? 0 : (_bytes - _header_bytes) / sizeof(T); }
+			bool		empty() const { return _size == 0; }
+			size_type	max_size() const { return (std::numeric_limits<off_t>::max() - _header_bytes) / sizeof(T); }
+
+			void	reserve(size_type n) {
+				if (n > capacity())
+					_remap(_header_bytes + n * sizeof(T));
+			}
+
+			void	shrink_to_fit() {
+				if (is_open() && _size < capacity())
+					_remap(_header_bytes + _size * sizeof(T));
+			}
+
+			/* ------------------------------------------------------------- */
+			/**
+			*   Element access
+			*/
+			/* ------------------------------------------------------------- */
+
+			reference		operator[](size_type n) { return data()[n]; }
+			const_reference	operator[](size_type n) const { return data()[n]; }
+			reference		at(size_type n) {
+				if (n >= _size)
+					throw std::out_of_range("ft::mapped_vector");
+				return data()[n];
+			}
+			const_reference	at(size_type n) const {
+				if (n >= _size)
+					throw std::out_of_range("ft::mapped_vector");
+				return data()[n];
+			}
+			reference		front() { return data()[0]; }
+			const_reference	front() const { return data()[0]; }
+			reference		back() { return data()[_size - 1]; }
+			const_reference	back() const { return data()[_size - 1]; }
+			pointer			data() { return _map ? reinterpret_cast<pointer>(_map + _header_bytes) : nullptr; }
+			const_pointer	data() const { return _map ? reinterpret_cast<const_pointer>(_map + _header_bytes) : nullptr; }
+
+			/* ------------------------------------------------------------- */
+			/**
+			*   Iterators
+			*/
+			/* ------------------------------------------------------------- */
+
+			iterator				begin() { return iterator(data()); }
+			const_iterator			begin() const { return const_iterator(data()); }
+			iterator				end() { return iterator(data() + _size); }
+			const_iterator			end() const { return const_iterator(data() + _size); }
+			reverse_iterator		rbegin() { return reverse_iterator(end()); }
+			const_reverse_iterator	rbegin() const { return const_reverse_iterator(end()); }
+			reverse_iterator		rend() { return reverse_iterator(begin()); }
+			const_reverse_iterator	rend() const { return const_reverse_iterator(begin()); }
+
+			/* ------------------------------------------------------------- */
+			/**
+			*   Modifiers. The file must be open.
+			*/
+			/* ------------------------------------------------------------- */
+
+			void	push_back(const value_type& val) {
+				if (_size == capacity()) {
+					value_type	copy = val;
+
+					_grow(_size + 1);
+					data()[_size++] = copy;
+					return ;
+				}
+				data()[_size++] = val;
+			}
+
+			void	pop_back() { _size--; }
+
+			void	append(const value_type *first, size_type n) {
+				if (_size + n > capacity()) {
+					if (first >= data() && first < data() + _size) {
+						size_type	offset = first - data();
+
+						_grow(_size + n);
+						first = data() + offset;
+					}
+					else
+						_grow(_size + n);
+				}
+				memmove(data() + _size, first, n * sizeof(T));
+				_size += n;
+			}
+
+			void	resize(size_type n, const value_type& val = value_type()) {
+				if (n > capacity()) {
+					value_type	copy = val;
+
+					_grow(n);
+					std::fill(data() + _size, data() + n, copy);
+				}
+				else if (n > _size)
+					std::fill(data() + _size, data() + n, val);
+				_size = n;
+			}
+
+			void	clear() { _size = 0; }
+
+			void	swap(mapped_vector& x) {
+				ft::swap(_fd, x._fd);
+				ft::swap(_map, x._map);
+				ft::swap(_bytes, x._bytes);
+				ft::swap(_size, x._size);
+			}
+
+		private:
+			mapped_vector(const mapped_vector&);
+			mapped_vector&	operator=(const mapped_vector&);
+
+			header*	_header() { return reinterpret_cast<header *>(_map); }
+
+			void	_error(const char *what) {
+				throw std::runtime_error(std::string("ft::mapped_vector: ") + what + ": " + strerror(errno));
+			}
+
+			void	_fail(const char *what) {
+				std::string	msg = std::string("ft::mapped_vector: ") + what + ": " + strerror(errno);
+
+				_release();
+				throw std::runtime_error(msg);
+			}
+
+			void	_invalid(const char *what) {
+				_release();
+				throw std::runtime_error(std::string("ft::mapped_vector: ") + what);
+			}
+
+			void	_release() {
+				if (_map != nullptr)
+					munmap(_map, _bytes);
+				if (_fd >= 0)
+					::close(_fd);
+				_fd = -1;
+				_map = nullptr;
+				_bytes = 0;
+				_size = 0;
+			}
+
+			void	_unmap() {
+				_header()->size = _size;
+				_release();
+			}
+
+			void	_grow(size_type n) {
+				size_type	cap = capacity();
+
+				_remap(_header_bytes + std::max(n, 2 * cap) * sizeof(T));
+			}
+
+				// Resizes the file, then the mapping to bytes rounded up to a page.
+				// A shrink remaps first and truncates last, so a failed
+				// ftruncate only leaves the file longer than the mapping
+			void	_remap(size_t bytes) {
+				size_t	page = sysconf(_SC_PAGESIZE);
+				size_t	old;
+				void	*map;
+
+				bytes = (bytes + page - 1) / page * page;
+				if (bytes > _bytes && ftruncate(_fd, bytes) < 0)
+					_error("ftruncate");
+# ifdef MREMAP_MAYMOVE
+				map = mremap(_map, _bytes, bytes, MREMAP_MAYMOVE);
+# else
+				map = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+				if (map != MAP_FAILED)
+					munmap(_map, _bytes);
+# endif
+				if (map == MAP_FAILED)
+					_error("mremap");
+				old = _bytes;
+				_map = static_cast<char *>(map);
+				_bytes = bytes;
+				if (bytes < old && ftruncate(_fd, bytes) < 0)
+					_error("ftruncate");
+			}
+	};
+
+	template <class T>
+	void	swap(mapped_vector<T>& x, mapped_vector<T>& y) { x.swap(y); }
+}
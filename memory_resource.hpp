@@ -0,0 +1,389 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   memory_resource.hpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 13:32:38 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/21 14:18:49 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+# include <new>
+# include <limits>
+# include <cstdlib>
+# include <functional>
+# include <stddef.h>
+# include <pthread.h>
+# include "arena.hpp"
+# include "vector.hpp"
+# include "map.hpp"
+
+namespace ft
+{
+	/**
+    * ------------------------------------------------------------- *
+    * ------------------------- FT::PMR --------------------------- *
+    *
+    * The allocation strategy picked at runtime instead of in the
+    * container's type. Containers use polymorphic_allocator<T>,
+    * which forwards to a memory_resource through a pointer. So one
+    * ft::pmr::vector<T> or ft::pmr::map<K, V> type runs on any
+    * resource, for the price of a virtual call per allocation.
+    *
+    * - Resources:
+    * new_delete_resource():            operator new and delete
+    * unsynchronized_pool_resource:     Free lists of blocks for
+    *                                   sizes up to 4 KB, in powers of
+    *                                   two and carved from chunks of
+    *                                   the upstream resource. Larger
+    *                                   requests go upstream
+    * synchronized_pool_resource:       The same under a mutex
+    * monotonic_buffer_resource:        An ft::arena, deallocate does
+    *                                   nothing, release() frees all
+    *
+    * get_default_resource() is what a default polymorphic_allocator
+    * uses, new_delete_resource() until set_default_resource().
+    * Allocators compare equal when their resources are the same
+    * object (or say they are equal through is_equal). Like
+    * ft::arena_allocator, they are kept on assignment and exchanged
+    * on swap.
+    * ------------------------------------------------------------- *
+    */
+
+	namespace pmr
+	{
+		static const size_t	max_align = alignof(max_align_t);
+
+		class memory_resource
+		{
+			public:
+				virtual ~memory_resource() { }
+
+				void	*allocate(size_t bytes, size_t align = max_align) { return do_allocate(bytes, align); }
+				void	deallocate(void *p, size_t bytes, size_t align = max_align) { do_deallocate(p, bytes, align); }
+				bool	is_equal(const memory_resource& x) const { return do_is_equal(x); }
+
+			protected:
+				virtual void	*do_allocate(size_t bytes, size_t align) = 0;
+				virtual void	do_deallocate(void *p, size_t bytes, size_t align) = 0;
+				virtual bool	do_is_equal(const memory_resource& x) const { return this == &x; }
+		};
+
+		inline bool	operator==(const memory_resource& x, const memory_resource& y) {
+			return &x == &y || x.is_equal(y);
+		}
+
+		inline bool	operator!=(const memory_resource& x, const memory_resource& y) { return !(x == y); }
+
+		/* ------------------------------------------------------------- */
+		/* -------------------- NEW_DELETE_RESOURCE -------------------- */
+
+		class new_delete_memory_resource : public memory_resource
+		{
+			protected:
+				void	*do_allocate(size_t bytes, size_t align) {
+					void	*p;
+
+					if (align <= max_align)
+						return ::operator new(bytes);
+					if (posix_memalign(&p, align, bytes) != 0)
+						throw std::bad_alloc();
+					return p;
+				}
+				void	do_deallocate(void *p, size_t, size_t align) {
+					if (align <= max_align)
+						::operator delete(p);
+					else
+						free(p);
+				}
+		};
+
+		inline memory_resource	*new_delete_resource() {
+			static new_delete_memory_resource	resource;
+
+			return &resource;
+		}
+
+		namespace detail
+		{
+			inline memory_resource	*&default_resource() {
+				static memory_resource	*resource = new_delete_resource();
+
+				return resource;
+			}
+		}
+
+		inline memory_resource	*get_default_resource() {
+			return __atomic_load_n(&detail::default_resource(), __ATOMIC_ACQUIRE);
+		}
+
+			// Returns the previous default, NULL restores new_delete_resource()
+		inline memory_resource	*set_default_resource(memory_resource *r) {
+			return __atomic_exchange_n(&detail::default_resource(), r ? r : new_delete_resource(), __ATOMIC_ACQ_REL);
+		}
+
+		/* ------------------------------------------------------------- */
+		/* ---------------- UNSYNCHRONIZED_POOL_RESOURCE --------------- */
+
+		class unsynchronized_pool_resource : public memory_resource
+		{
+			public:
+				static const size_t	min_block = 8;
+				static const size_t	max_block = 4096;
+				static const size_t	classes = 10;
+
+				explicit unsynchronized_pool_resource(memory_resource *upstream = get_default_resource())
+					: _upstream(upstream), _chunks(NULL) {
+					for (size_t c = 0; c < classes; c++) {
+						_free[c] = NULL;
+						_next_blocks[c] = 16;
+					}
+				}
+
+				~unsynchronized_pool_resource() { release(); }
+
+					// Gives every chunk back upstream, including blocks in use
+				void	release() {
+					while (_chunks != NULL) {
+						chunk	*next = _chunks->next;
+
+						_upstream->deallocate(_chunks, _chunks->bytes);
+						_chunks = next;
+					}
+					for (size_t c = 0; c < classes; c++) {
+						_free[c] = NULL;
+						_next_blocks[c] = 16;
+					}
+				}
+
+				memory_resource	*upstream_resource() const { return _upstream; }
+
+			protected:
+				void	*do_allocate(size_t bytes, size_t align) {
+					size_t	c;
+					block	*b;
+
+					if (bytes > max_block || align > max_align)
+						return _upstream->allocate(bytes, align);
+					c = _class(bytes < align ? align : bytes);
+					if (_free[c] == NULL)
+						_refill(c);
+					b = _free[c];
+					_free[c] = b->next;
+					return b;
+				}
+
+				void	do_deallocate(void *p, size_t bytes, size_t align) {
+					size_t	c;
+					block	*b;
+
+					if (bytes > max_block || align > max_align) {
+						_upstream->deallocate(p, bytes, align);
+						return ;
+					}
+					c = _class(bytes < align ? align : bytes);
+					b = static_cast<block *>(p);
+					b->next = _free[c];
+					_free[c] = b;
+				}
+
+			private:
+				struct block
+				{
+					block	*next;
+				};
+
+					// Header of a chunk taken upstream, blocks start past it
+				struct alignas(max_align_t) chunk
+				{
+					chunk	*next;
+					size_t	bytes;
+				};
+
+				memory_resource	*_upstream;
+				chunk			*_chunks;
+				block			*_free[classes];
+				size_t			_next_blocks[classes];
+
+				unsynchronized_pool_resource(const unsynchronized_pool_resource&);
+				unsynchronized_pool_resource&	operator=(const unsynchronized_pool_resource&);
+
+					// 8 -> 0, 16 -> 1, ... 4096 -> 9
+				static size_t	_class(size_t bytes) {
+					size_t	c = 0;
+
+					for (size_t size = min_block; size < bytes; size <<= 1)
+						c++;
+					return c;
+				}
+
+					// A chunk of blocks for class c, twice as many as the last
+					// one up to 64 KB of blocks
+				void	_refill(size_t c) {
+					size_t	size = min_block << c;
+					size_t	n = _next_blocks[c];
+					size_t	bytes = sizeof(chunk) + n * size;
+					chunk	*k = static_cast<chunk *>(_upstream->allocate(bytes));
+					char	*p = reinterpret_cast<char *>(k + 1);
+
+					k->next = _chunks;
+					k->bytes = bytes;
+					_chunks = k;
+					for (size_t i = n; i > 0; i--) {
+						block	*b = reinterpret_cast<block *>(p + (i - 1) * size);
+
+						b->next = _free[c];
+						_free[c] = b;
+					}
+					if (n * size * 2 <= 64 * 1024)
+						_next_blocks[c] = n * 2;
+				}
+		};
+
+		/* ------------------------------------------------------------- */
+		/* ----------------- SYNCHRONIZED_POOL_RESOURCE ---------------- */
+
+		class synchronized_pool_resource : public memory_resource
+		{
+			public:
+				explicit synchronized_pool_resource(memory_resource *upstream = get_default_resource())
+					: _pool(upstream) {
+					pthread_mutex_init(&_lock, NULL);
+				}
+
+				~synchronized_pool_resource() { pthread_mutex_destroy(&_lock); }
+
+				void	release() {
+					pthread_mutex_lock(&_lock);
+					_pool.release();
+					pthread_mutex_unlock(&_lock);
+				}
+
+				memory_resource	*upstream_resource() const { return _pool.upstream_resource(); }
+
+			protected:
+				void	*do_allocate(size_t bytes, size_t align) {
+					void	*p;
+
+					pthread_mutex_lock(&_lock);
+					try {
+						p = _pool.allocate(bytes, align);
+					}
+					catch (...) {
+						pthread_mutex_unlock(&_lock);
+						throw;
+					}
+					pthread_mutex_unlock(&_lock);
+					return p;
+				}
+
+				void	do_deallocate(void *p, size_t bytes, size_t align) {
+					pthread_mutex_lock(&_lock);
+					_pool.deallocate(p, bytes, align);
+					pthread_mutex_unlock(&_lock);
+				}
+
+			private:
+				unsynchronized_pool_resource	_pool;
+				pthread_mutex_t					_lock;
+
+				synchronized_pool_resource(const synchronized_pool_resource&);
+				synchronized_pool_resource&	operator=(const synchronized_pool_resource&);
+		};
+
+		/* ------------------------------------------------------------- */
+		/* ----------------- MONOTONIC_BUFFER_RESOURCE ----------------- */
+
+		class monotonic_buffer_resource : public memory_resource
+		{
+			public:
+				explicit monotonic_buffer_resource(size_t chunk_size = ft::arena::default_chunk)
+					: _arena(chunk_size) { }
+
+					// Frees the chunks; reset() keeps them for the next round
+				void	release() { _arena.release(); }
+				void	reset() { _arena.reset(); }
+
+				ft::arena&	arena() { return _arena; }
+
+			protected:
+				void	*do_allocate(size_t bytes, size_t align) { return _arena.allocate(bytes, align); }
+				void	do_deallocate(void *, size_t, size_t) { }
+
+			private:
+				ft::arena	_arena;
+
+				monotonic_buffer_resource(const monotonic_buffer_resource&);
+				monotonic_buffer_resource&	operator=(const monotonic_buffer_resource&);
+		};
+
+		/* ------------------------------------------------------------- */
+		/* -------------------- POLYMORPHIC_ALLOCATOR ------------------ */
+
+		template <class T>
+		class polymorphic_allocator
+		{
+			public:
+				typedef T			value_type;
+				typedef T*			pointer;
+				typedef const T*	const_pointer;
+				typedef T&			reference;
+				typedef const T&	const_reference;
+				typedef size_t		size_type;
+				typedef ptrdiff_t	difference_type;
+
+				template <class U>
+				struct rebind { typedef polymorphic_allocator<U> other; };
+
+				polymorphic_allocator() : _resource(get_default_resource()) { }
+				polymorphic_allocator(memory_resource *r) : _resource(r) { }
+				polymorphic_allocator(const polymorphic_allocator& x) : _resource(x._resource) { }
+				template <class U>
+				polymorphic_allocator(const polymorphic_allocator<U>& x) : _resource(x.resource()) { }
+
+				polymorphic_allocator&	operator=(const polymorphic_allocator& x) {
+					_resource = x._resource;
+					return *this;
+				}
+
+				pointer	allocate(size_type n, const void * = NULL) {
+					if (n > max_size())
+						throw std::bad_alloc();
+					return static_cast<pointer>(_resource->allocate(n * sizeof(T), alignof(T)));
+				}
+				void	deallocate(pointer p, size_type n) { _resource->deallocate(p, n * sizeof(T), alignof(T)); }
+
+				size_type	max_size() const { return std::numeric_limits<size_type>::max() / sizeof(T); }
+				void		construct(pointer p, const_reference val) { new (static_cast<void *>(p)) T(val); }
+				void		destroy(pointer p) { p->~T(); }
+				pointer			address(reference x) const { return &x; }
+				const_pointer	address(const_reference x) const { return &x; }
+
+				memory_resource	*resource() const { return _resource; }
+
+			private:
+				memory_resource	*_resource;
+		};
+
+		template <class T, class U>
+		bool	operator==(const polymorphic_allocator<T>& x, const polymorphic_allocator<U>& y) {
+			return *x.resource() == *y.resource();
+		}
+
+		template <class T, class U>
+		bool	operator!=(const polymorphic_allocator<T>& x, const polymorphic_allocator<U>& y) {
+			return !(x == y);
+		}
+
+			// Container types whose strategy is a constructor argument
+		template <class T>
+		using vector = ft::vector<T, polymorphic_allocator<T> >;
+
+		template <class Key, class T, class Compare = std::less<Key> >
+		using map = ft::map<Key, T, Compare, polymorphic_allocator<ft::pair<const Key, T> > >;
+	}
+}
@@ -0,0 +1,414 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parallel_algorithm.hpp                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:43:56 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/20 15:09:50 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+# include <functional>
+# include "thread_pool.hpp"
+# include "vector.hpp"
+
+namespace ft
+{
+	/**
+    * ------------------------------------------------------------- *
+    * -------------------- PARALLEL ALGORITHMS -------------------- *
+    *
+    * Overloads of the usual algorithms taking a thread_pool first,
+    * for random-access ranges (ft::vector iterators, pointers).
+    * The range is cut into chunks of `grain` elements (0 picks it
+    * from the pool size) processed on the pool's threads.
+    *
+    * for_each:             Apply function to range
+    * transform:            Transform range into another
+    * reduce:               Fold range with an associative operation
+    * inclusive_scan:       Prefix sums with an associative operation
+    * count_if:             Count elements matching a predicate
+    * find_if:              Find first element matching a predicate
+    *
+    * - Ordered ranges, for containers that cannot be indexed: the
+    * bounds come from ft::map::partition and subrange i is
+    * [bounds[i], bounds[i + 1]). Each subrange is one chunk, the
+    * pool's stealing evens out their sizes.
+    * for_each_range:       Apply function to each subrange
+    * for_each:             Apply function to every element
+    * transform_reduce:     Fold transformed elements, in key order
+    * reduce:               Fold elements, in key order
+    * ------------------------------------------------------------- *
+    */
+
+	namespace parallel_detail
+	{
+		template <class Iterator, class Function>
+		struct for_each_ctx
+		{
+			Iterator	first;
+			Function	*fn;
+
+			static void	run(void *p, size_t begin, size_t end) {
+				for_each_ctx	*ctx = static_cast<for_each_ctx *>(p);
+				for (Iterator it = ctx->first + begin, last = ctx->first + end; it != last; ++it)
+					(*ctx->fn)(*it);
+			}
+		};
+
+		template <class InputIt, class OutputIt, class UnaryOperation>
+		struct transform_ctx
+		{
+			InputIt			first;
+			OutputIt		out;
+			UnaryOperation	*op;
+
+			static void	run(void *p, size_t begin, size_t end) {
+				transform_ctx	*ctx = static_cast<transform_ctx *>(p);
+				OutputIt		out = ctx->out + begin;
+				for (InputIt it = ctx->first + begin, last = ctx->first + end; it != last; ++it, ++out)
+					*out = (*ctx->op)(*it);
+			}
+		};
+
+			// Each chunk folds into its own slot, slots are combined in order
+		template <class Iterator, class T, class BinaryOperation>
+		struct reduce_ctx
+		{
+			Iterator			first;
+			BinaryOperation		*op;
+			ft::vector<T>		*partial;
+			size_t				grain;
+
+			static void	run(void *p, size_t begin, size_t end) {
+				reduce_ctx	*ctx = static_cast<reduce_ctx *>(p);
+				Iterator	it = ctx->first + begin;
+				T			acc = *it;
+				for (Iterator last = ctx->first + end; ++it != last; )
+					acc = (*ctx->op)(acc, *it);
+				(*ctx->partial)[begin / ctx->grain] = acc;
+			}
+		};
+
+			// Second scan pass: chunk c starts from the total of chunks [0, c)
+		template <class InputIt, class OutputIt, class T, class BinaryOperation>
+		struct scan_ctx
+		{
+			InputIt				first;
+			OutputIt			out;
+			BinaryOperation		*op;
+			ft::vector<T>		*offset;
+			size_t				grain;
+
+			static void	run(void *p, size_t begin, size_t end) {
+				scan_ctx	*ctx = static_cast<scan_ctx *>(p);
+				size_t		chunk = begin / ctx->grain;
+				InputIt		it = ctx->first + begin;
+				OutputIt	out = ctx->out + begin;
+				T			acc = chunk ? (*ctx->op)((*ctx->offset)[chunk - 1], *it) : T(*it);
+				*out = acc;
+				for (InputIt last = ctx->first + end; ++it != last; ) {
+					acc = (*ctx->op)(acc, *it);
+					*++out = acc;
+				}
+			}
+		};
+
+		template <class Iterator, class Predicate>
+		struct count_if_ctx
+		{
+			Iterator			first;
+			Predicate			*pred;
+			size_t				count;
+
+			static void	run(void *p, size_t begin, size_t end) {
+				count_if_ctx	*ctx = static_cast<count_if_ctx *>(p);
+				size_t			n = 0;
+				for (Iterator it = ctx->first + begin, last = ctx->first + end; it != last; ++it)
+					if ((*ctx->pred)(*it))
+						n++;
+				__atomic_add_fetch(&ctx->count, n, __ATOMIC_RELAXED);
+			}
+		};
+
+			// found holds the lowest matching index so far, chunks past it are skipped
+		template <class Iterator, class Predicate>
+		struct find_if_ctx
+		{
+			Iterator			first;
+			Predicate			*pred;
+			size_t				found;
+
+			static void	run(void *p, size_t begin, size_t end) {
+				find_if_ctx	*ctx = static_cast<find_if_ctx *>(p);
+				for (size_t i = begin; i < end; i++) {
+					size_t	found = __atomic_load_n(&ctx->found, __ATOMIC_RELAXED);
+					if (found <= i)
+						return;
+					if ((*ctx->pred)(ctx->first[i])) {
+						while (i < found && !__atomic_compare_exchange_n(&ctx->found, &found, i, false,
+															__ATOMIC_RELAXED, __ATOMIC_RELAXED))
+							;
+						return;
+					}
+				}
+			}
+		};
+
+		template <class Iterator, class Function>
+		struct range_ctx
+		{
+			const ft::vector<Iterator>	*bounds;
+			Function					*fn;
+
+			static void	run(void *p, size_t begin, size_t end) {
+				range_ctx	*ctx = static_cast<range_ctx *>(p);
+				for (size_t i = begin; i < end; i++)
+					(*ctx->fn)(i, (*ctx->bounds)[i], (*ctx->bounds)[i + 1]);
+			}
+		};
+
+		template <class Function>
+		struct apply_each
+		{
+			Function	*fn;
+
+			template <class Iterator>
+			void	operator()(size_t, Iterator first, Iterator last) const {
+				for ( ; first != last; ++first)
+					(*fn)(*first);
+			}
+		};
+
+			// Folds subrange i into partial[i], used[i] tells empty ones apart
+		template <class T, class BinaryOperation, class UnaryOperation>
+		struct fold_range
+		{
+			BinaryOperation		*op;
+			UnaryOperation		*transform;
+			ft::vector<T>		*partial;
+			ft::vector<char>	*used;
+
+			template <class Iterator>
+			void	operator()(size_t i, Iterator first, Iterator last) const {
+				if (first == last)
+					return;
+				T	acc = (*transform)(*first);
+				while (++first != last)
+					acc = (*op)(acc, (*transform)(*first));
+				(*partial)[i] = acc;
+				(*used)[i] = 1;
+			}
+		};
+
+		struct identity
+		{
+			template <class T>
+			const T&	operator()(const T& x) const { return x; }
+		};
+	}
+
+	/* ------------------------------------------------------------- */
+	/**
+	*   @brief  for_each Applies fn to every element of [first, last). fn is
+	*   shared by all threads, so it must not keep unsynchronized state.
+	*/
+	/* ------------------------------------------------------------- */
+
+	template <class RandomIt, class Function>
+	void	for_each(thread_pool& pool, RandomIt first, RandomIt last, Function fn, size_t grain = 0)
+	{
+		parallel_detail::for_each_ctx<RandomIt, Function>	ctx = { first, &fn };
+
+		pool.parallel_for(last - first, grain, ctx.run, &ctx);
+	}
+
+	/* ------------------------------------------------------------- */
+	/**
+	*   @brief  transform Stores op(x) for every x of [first, last) in the range
+	*   starting at out, which may be first itself.
+	*/
+	/* ------------------------------------------------------------- */
+
+	template <class RandomIt, class OutputIt, class UnaryOperation>
+	OutputIt	transform(thread_pool& pool, RandomIt first, RandomIt last, OutputIt out,
+							UnaryOperation op, size_t grain = 0)
+	{
+		parallel_detail::transform_ctx<RandomIt, OutputIt, UnaryOperation>	ctx = { first, out, &op };
+
+		pool.parallel_for(last - first, grain, ctx.run, &ctx);
+		return out + (last - first);
+	}
+
+	/* ------------------------------------------------------------- */
+	/**
+	*   @brief  reduce Folds [first, last) into init with op, which must be
+	*   associative. Chunk results are combined in order, so op does not
+	*   have to be commutative.
+	*/
+	/* ------------------------------------------------------------- */
+
+	template <class RandomIt, class T, class BinaryOperation>
+	T	reduce(thread_pool& pool, RandomIt first, RandomIt last, T init, BinaryOperation op, size_t grain = 0)
+	{
+		size_t	n = last - first;
+
+		if (n == 0)
+			return init;
+		grain = pool.grain_for(n, grain);
+		ft::vector<T>	partial(pool.chunk_count(n, grain), init);
+		parallel_detail::reduce_ctx<RandomIt, T, BinaryOperation>	ctx = { first, &op, &partial, grain };
+		pool.parallel_for(n, grain, ctx.run, &ctx);
+		for (size_t i = 0; i < partial.size(); i++)
+			init = op(init, partial[i]);
+		return init;
+	}
+
+	template <class RandomIt, class T>
+	T	reduce(thread_pool& pool, RandomIt first, RandomIt last, T init)
+	{
+		return ft::reduce(pool, first, last, init, std::plus<T>());
+	}
+
+	/* ------------------------------------------------------------- */
+	/**
+	*   @brief  inclusive_scan Stores the running fold of [first, last) in the
+	*   range starting at out, which may be first itself. Two passes: chunk
+	*   totals in parallel, their prefix on the caller, then each chunk is
+	*   scanned from its offset in parallel.
+	*/
+	/* ------------------------------------------------------------- */
+
+	template <class RandomIt, class OutputIt, class BinaryOperation>
+	OutputIt	inclusive_scan(thread_pool& pool, RandomIt first, RandomIt last, OutputIt out,
+								BinaryOperation op, size_t grain = 0)
+	{
+		typedef typename ft::iterator_traits<RandomIt>::value_type	T;
+		size_t	n = last - first;
+
+		if (n == 0)
+			return out;
+		grain = pool.grain_for(n, grain);
+		ft::vector<T>	offset(pool.chunk_count(n, grain));
+		parallel_detail::reduce_ctx<RandomIt, T, BinaryOperation>	totals = { first, &op, &offset, grain };
+		pool.parallel_for(n, grain, totals.run, &totals);
+		for (size_t i = 1; i < offset.size(); i++)
+			offset[i] = op(offset[i - 1], offset[i]);
+		parallel_detail::scan_ctx<RandomIt, OutputIt, T, BinaryOperation>	ctx = { first, out, &op, &offset, grain };
+		pool.parallel_for(n, grain, ctx.run, &ctx);
+		return out + n;
+	}
+
+	template <class RandomIt, class OutputIt>
+	OutputIt	inclusive_scan(thread_pool& pool, RandomIt first, RandomIt last, OutputIt out)
+	{
+		typedef typename ft::iterator_traits<RandomIt>::value_type	T;
+
+		return ft::inclusive_scan(pool, first, last, out, std::plus<T>());
+	}
+
+	/* ------------------------------------------------------------- */
+	/**
+	*   @brief  count_if Returns the number of elements for which pred is true.
+	*/
+	/* ------------------------------------------------------------- */
+
+	template <class RandomIt, class Predicate>
+	typename ft::iterator_traits<RandomIt>::difference_type
+		count_if(thread_pool& pool, RandomIt first, RandomIt last, Predicate pred, size_t grain = 0)
+	{
+		parallel_detail::count_if_ctx<RandomIt, Predicate>	ctx = { first, &pred, 0 };
+
+		pool.parallel_for(last - first, grain, ctx.run, &ctx);
+		return ctx.count;
+	}
+
+	/* ------------------------------------------------------------- */
+	/**
+	*   @brief  find_if Returns the first element for which pred is true, or
+	*   last. Chunks after a match already found are not scanned.
+	*/
+	/* ------------------------------------------------------------- */
+
+	template <class RandomIt, class Predicate>
+	RandomIt	find_if(thread_pool& pool, RandomIt first, RandomIt last, Predicate pred, size_t grain = 0)
+	{
+		size_t	n = last - first;
+		parallel_detail::find_if_ctx<RandomIt, Predicate>	ctx = { first, &pred, n };
+
+		pool.parallel_for(n, grain, ctx.run, &ctx);
+		return first + ctx.found;
+	}
+
+	/* ------------------------------------------------------------- */
+	/**
+	*   @brief  for_each_range Calls fn(i, bounds[i], bounds[i + 1]) for every
+	*   subrange, in parallel. Results stored by i concatenate in key order.
+	*/
+	/* ------------------------------------------------------------- */
+
+	template <class Iterator, class Function>
+	void	for_each_range(thread_pool& pool, const ft::vector<Iterator>& bounds, Function fn)
+	{
+		parallel_detail::range_ctx<Iterator, Function>	ctx = { &bounds, &fn };
+
+		if (bounds.size() > 1)
+			pool.parallel_for(bounds.size() - 1, 1, ctx.run, &ctx);
+	}
+
+	/* ------------------------------------------------------------- */
+	/**
+	*   @brief  for_each Applies fn to every element of the subranges. fn is
+	*   shared by all threads, so it must not keep unsynchronized state.
+	*/
+	/* ------------------------------------------------------------- */
+
+	template <class Iterator, class Function>
+	void	for_each(thread_pool& pool, const ft::vector<Iterator>& bounds, Function fn)
+	{
+		parallel_detail::apply_each<Function>	each = { &fn };
+
+		ft::for_each_range(pool, bounds, each);
+	}
+
+	/* ------------------------------------------------------------- */
+	/**
+	*   @brief  transform_reduce Folds transform(x) for every element into
+	*   init with op, which must be associative. Subrange results are
+	*   combined in key order, so op does not have to be commutative.
+	*/
+	/* ------------------------------------------------------------- */
+
+	template <class Iterator, class T, class BinaryOperation, class UnaryOperation>
+	T	transform_reduce(thread_pool& pool, const ft::vector<Iterator>& bounds, T init,
+							BinaryOperation op, UnaryOperation transform)
+	{
+		size_t	ranges = bounds.size() > 1 ? bounds.size() - 1 : 0;
+		ft::vector<T>		partial(ranges, init);
+		ft::vector<char>	used(ranges, 0);
+		parallel_detail::fold_range<T, BinaryOperation, UnaryOperation>	fold = { &op, &transform, &partial, &used };
+
+		ft::for_each_range(pool, bounds, fold);
+		for (size_t i = 0; i < ranges; i++)
+			if (used[i])
+				init = op(init, partial[i]);
+		return init;
+	}
+
+	/* ------------------------------------------------------------- */
+	/**
+	*   @brief  reduce Folds the elements of the subranges into init with op,
+	*   combining subrange results in key order.
+	*/
+	/* ------------------------------------------------------------- */
+
+	template <class Iterator, class T, class BinaryOperation>
+	T	reduce(thread_pool& pool, const ft::vector<Iterator>& bounds, T init, BinaryOperation op)
+	{
+		return ft::transform_reduce(pool, bounds, init, op, parallel_detail::identity());
+	}
+}
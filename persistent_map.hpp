@@ -0,0 +1,358 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   persistent_map.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:52:29 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/19 11:52:29 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+# include <stdexcept>
+# include "iterators/persistent_tree.hpp"
+
+namespace ft
+{
+	/**
+    * ------------------------------------------------------------- *
+    * ------------------- FT::PERSISTENT_MAP ---------------------- *
+    *
+    * An ordered map whose copies are O(1) immutable snapshots.
+    * Updates copy only the O(log n) path to the modified node; all
+    * other nodes stay shared between the versions. Elements are never
+    * handed out by non-const reference, so a snapshot can be read
+    * from another thread while the original keeps being modified.
+    * Iterators are invalidated by any modification of the map they
+    * come from; iterate over a snapshot to get stable iterators.
+    *
+    * - Coplien form:
+    * (constructor):        Construct map
+    * (destructor):         Destruct map
+    * operator=:            Assign map (O(1))
+    * snapshot:             Return an immutable view of the map (O(1))
+    *
+    * - Iterators:
+    * begin:                Return iterator to beginning
+    * end:                  Return iterator to end
+    * rbegin:               Return reverse iterator to reverse beginning
+    * rend:                 Return reverse iterator to reverse end
+    *
+    * - Capacity:
+    * size:                 Return size
+    * max_size:             Return maximum size
+    * empty:                Test whether map is empty
+    *
+    * - Element access:
+    * at:                   Access element
+    *
+    * - Modifiers:
+    * insert:               Insert elements
+    * insert_or_assign:     Insert element or replace its mapped value
+    * erase:                Erase elements
+    * swap:                 Swap content
+    * clear:                Clear content
+    *
+    * - Non-member function overloads:
+    * relational operators: Relational operators for persistent_map
+    * swap:                 Exchange contents of two persistent_maps
+    * ------------------------------------------------------------- *
+    */
+
+	template<class Key, class T, class Compare = std::less<Key>, class Allocator = std::allocator<ft::pair<const Key, T> > >
+	class persistent_map
+	{
+		public:
+			/* ------------------------------------------------------------- */
+    	    /* -------------------------- ALIASES -------------------------- */
+			typedef	Key															key_type;
+			typedef	T															mapped_type;
+			typedef	Compare														key_compare;
+			typedef	typename ft::pair<const Key, T>								value_type;
+			typedef	Allocator													allocator_type;
+			typedef	typename allocator_type::const_reference					const_reference;
+			typedef	typename allocator_type::const_pointer						const_pointer;
+			typedef	typename allocator_type::size_type							size_type;
+			typedef typename allocator_type::difference_type					difference_type;
+
+			class value_compare
+			{
+				private:
+					friend class persistent_map;
+				protected:
+					Compare				comp;
+					value_compare	(Compare c) : comp(c) {}
+				public:
+					typedef bool		result_type;
+					typedef value_type	first_argument_type;
+					typedef value_type	second_argument_type;
+
+					bool	operator() (const value_type& x, const value_type& y) const {
+						return comp(x.first, y.first);
+					}
+			};
+
+			typedef	ft::persistent_tree<value_type, value_compare, allocator_type>	tree;
+			typedef	typename tree::iterator										iterator;
+			typedef	typename tree::const_iterator								const_iterator;
+			typedef	typename tree::reverse_iterator								reverse_iterator;
+			typedef	typename tree::const_reverse_iterator						const_reverse_iterator;
+
+		private:
+    	    /* ------------------------------------------------------------- */
+    	    /* ------------------------- ATTRIBUTES ------------------------ */
+			key_compare				_comp;
+			allocator_type			_alloc;
+			tree					_tree;
+
+		public:
+			/* ------------------------------------------------------------- */
+    	    /* ---------------------------- BODY --------------------------- */
+
+ 			/* ------------------------------------------------------------- */
+            /**
+            *   Default constructor, creates a map with a size of 0.
+            */
+            /* ------------------------------------------------------------- */
+
+			explicit persistent_map (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+						: _comp(comp), _alloc(alloc), _tree(value_compare(comp), alloc) { }
+
+			/* ------------------------------------------------------------- */
+            /**
+            *   Range constructor, inserts the elements of the range between two iterators.
+            */
+            /* ------------------------------------------------------------- */
+
+			template <class InputIterator>
+			persistent_map (InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
+				const allocator_type& alloc = allocator_type()) : _comp(comp), _alloc(alloc), _tree(value_compare(comp), alloc) {
+				insert(first, last);
+			}
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Copy constructor, shares the whole tree of x: O(1).
+            *
+            *   @param x        The map that will be copied.
+            */
+            /* ------------------------------------------------------------- */
+
+			persistent_map (const persistent_map& x) : _comp(x.key_comp()), _alloc(x.get_allocator()), _tree(x._tree) { }
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Destructor, releases the nodes no other snapshot refers to.
+            */
+            /* ------------------------------------------------------------- */
+
+			~persistent_map () { }
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Assigns a map to this map by sharing its tree: O(1).
+            *
+            *   @param x        The map that will be assigned.
+            */
+            /* ------------------------------------------------------------- */
+
+			persistent_map& operator= (const persistent_map& x) {
+				_alloc = x.get_allocator();
+				_comp = x.key_comp();
+				_tree = x._tree;
+				return *this;
+			}
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Returns a point-in-time view of the map. Later modifications of
+            *   this map are not visible through it.
+            */
+            /* ------------------------------------------------------------- */
+
+			const persistent_map	snapshot() const { return *this; }
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Allocator getter, returns the allocator used by the map.
+            */
+            /* ------------------------------------------------------------- */
+
+			allocator_type get_allocator() const { return _alloc; }
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Element access, returns a const reference to the mapped value of k.
+            *   There is no operator[]: elements may be shared with snapshots.
+            */
+            /* ------------------------------------------------------------- */
+
+			const mapped_type& at (const key_type& k) const {
+				const PNode<value_type>* tmp = _tree.find(ft::make_pair(k, mapped_type()));
+				if (tmp == nullptr)
+					throw std::out_of_range("ft::persistent_map::at");
+				return (tmp->value.second);
+			}
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Iterators, returns an iterator to an element of the map.
+            */
+            /* ------------------------------------------------------------- */
+
+			const_iterator begin() const { return _tree.begin(); }
+
+			/* ------------------------------------------------------------- */
+
+			const_iterator end() const { return _tree.end(); }
+
+			/* ------------------------------------------------------------- */
+
+			const_reverse_iterator rbegin() const { return const_reverse_iterator(_tree.end()); }
+
+			/* ------------------------------------------------------------- */
+
+			const_reverse_iterator rend() const { return const_reverse_iterator(_tree.begin()); }
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Capacity, returns the size of the map.
+            */
+            /* ------------------------------------------------------------- */
+
+			bool empty() const { return _tree.empty(); }
+
+			/* ------------------------------------------------------------- */
+
+			size_type size() const { return _tree.size(); }
+
+			/* ------------------------------------------------------------- */
+
+			size_type max_size() const { return _tree.max_size(); }
+
+			/* ------------------------------------------------------------- */
+			/**
+			*   Modifiers, return true if a new element was inserted.
+			*/
+			/* ------------------------------------------------------------- */
+
+			void clear() { _tree.clear(); }
+
+			/* ------------------------------------------------------------- */
+
+			bool insert (const value_type& val) { return _tree.insert(val); }
+
+			/* ------------------------------------------------------------- */
+
+			template <class InputIterator>
+			void insert (InputIterator first, InputIterator last) {
+				for (; first != last; first++)
+					insert(*first);
+			}
+
+			/* ------------------------------------------------------------- */
+
+			bool insert_or_assign (const key_type& k, const mapped_type& obj) {
+				return _tree.assign(ft::make_pair(k, obj));
+			}
+
+			/* ------------------------------------------------------------- */
+
+			void erase (const_iterator position) { _tree.erase(*position); }
+
+			/* ------------------------------------------------------------- */
+
+			size_type erase (const key_type& k) { return _tree.erase(ft::make_pair(k, mapped_type())); }
+
+			/* ------------------------------------------------------------- */
+
+			void swap (persistent_map& x) {
+				ft::swap(_comp, x._comp);
+				ft::swap(_alloc, x._alloc);
+				_tree.swap(x._tree);
+			}
+
+			/* ------------------------------------------------------------- */
+   			/**
+   			*   Lookup operators
+   			*/
+   			/* ------------------------------------------------------------- */
+
+			size_type count (const key_type& k) const {
+				return _tree.count(ft::make_pair(k, mapped_type()));
+			}
+
+			/* ------------------------------------------------------------- */
+
+			const_iterator find (const key_type& k) const { return _tree.iter_find(ft::make_pair(k, mapped_type())); }
+
+			/* ------------------------------------------------------------- */
+
+			pair<const_iterator,const_iterator> equal_range (const key_type& k) const {
+				return ft::make_pair(lower_bound(k), upper_bound(k));
+			}
+
+			/* ------------------------------------------------------------- */
+
+			const_iterator lower_bound (const key_type& k) const { return _tree.lower_bound(ft::make_pair(k, mapped_type())); }
+
+			/* ------------------------------------------------------------- */
+
+			const_iterator upper_bound (const key_type& k) const { return _tree.upper_bound(ft::make_pair(k, mapped_type())); }
+
+			/* ------------------------------------------------------------- */
+
+			key_compare key_comp() const { return _comp; }
+			value_compare value_comp() const { return value_compare(_comp); }
+	};
+
+    /* ------------------------------------------------------------- */
+    /**
+    *   Relational operators
+    */
+    /* ------------------------------------------------------------- */
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator==( const persistent_map<Key,T,Compare,Alloc>& lhs, const persistent_map<Key,T,Compare,Alloc>& rhs ) {
+		if (lhs.size() != rhs.size())
+			return false;
+		return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator!= ( const persistent_map<Key,T,Compare,Alloc>& lhs, const persistent_map<Key,T,Compare,Alloc>& rhs ) {
+		return !(lhs == rhs);
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator< ( const persistent_map<Key,T,Compare,Alloc>& lhs, const persistent_map<Key,T,Compare,Alloc>& rhs ) {
+		return ft::lexicographical_compare (lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator<= ( const persistent_map<Key,T,Compare,Alloc>& lhs, const persistent_map<Key,T,Compare,Alloc>& rhs ) {
+		return 	!(rhs < lhs);
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator>  ( const persistent_map<Key,T,Compare,Alloc>& lhs, const persistent_map<Key,T,Compare,Alloc>& rhs ) {
+		return rhs < lhs;
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator>= ( const persistent_map<Key,T,Compare,Alloc>& lhs, const persistent_map<Key,T,Compare,Alloc>& rhs ) {
+		return 	!(lhs < rhs);
+	}
+
+	/* ------------------------------------------------------------- */
+	/**
+	*   Swap
+	*/
+	/* ------------------------------------------------------------- */
+
+	template <class Key, class T, class Compare, class Alloc>
+	void swap (persistent_map<Key,T,Compare,Alloc>& lhs, persistent_map<Key,T,Compare,Alloc>& rhs) { lhs.swap(rhs); }
+}
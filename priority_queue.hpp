@@ -0,0 +1,334 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   priority_queue.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 22:13:44 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/19 22:13:44 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+# include <functional>
+# include <stdexcept>
+# include "vector.hpp"
+# include "utility.hpp"
+
+namespace ft
+{
+	/* ------------------------------------------------------------- */
+    /**
+    *   4-ary heap primitives. The children of i are 4i+1 .. 4i+4, so a
+    *   node's children share one or two cache lines and the heap is half
+    *   as tall as a binary one. Both sifts move a hole and write the
+    *   value once at the end.
+    */
+    /* ------------------------------------------------------------- */
+
+	namespace heap_detail
+	{
+		static const size_t	arity = 4;
+
+		inline size_t	parent(size_t i)	{ return (i - 1) / arity; }
+		inline size_t	child(size_t i)		{ return i * arity + 1; }
+
+		template <class RandomIt, class T, class Compare>
+		void	sift_up(RandomIt first, size_t hole, const T& val, Compare comp) {
+			while (hole > 0 && comp(first[parent(hole)], val)) {
+				first[hole] = first[parent(hole)];
+				hole = parent(hole);
+			}
+			first[hole] = val;
+		}
+
+		// Index of the greatest of the children of i, n > child(i)
+		template <class RandomIt, class Compare>
+		size_t	max_child(RandomIt first, size_t n, size_t i, Compare comp) {
+			size_t	best = child(i);
+			size_t	last = best + arity < n ? best + arity : n;
+
+			for (size_t c = best + 1; c < last; c++)
+				if (comp(first[best], first[c]))
+					best = c;
+			return best;
+		}
+
+		template <class RandomIt, class T, class Compare>
+		void	sift_down(RandomIt first, size_t n, size_t hole, const T& val, Compare comp) {
+			while (child(hole) < n) {
+				size_t	best = max_child(first, n, hole, comp);
+
+				if (!comp(val, first[best]))
+					break ;
+				first[hole] = first[best];
+				hole = best;
+			}
+			first[hole] = val;
+		}
+
+		// Floyd's bottom-up construction, O(n)
+		template <class RandomIt, class Compare>
+		void	make_heap(RandomIt first, size_t n, Compare comp) {
+			if (n < 2)
+				return ;
+			for (size_t i = parent(n - 1) + 1; i-- > 0; ) {
+				typename ft::iterator_traits<RandomIt>::value_type	val(first[i]);
+
+				sift_down(first, n, i, val, comp);
+			}
+		}
+	}
+
+	/**
+    * ------------------------------------------------------------- *
+    * -------------------- FT::PRIORITY_QUEUE --------------------- *
+    *
+    * Max-heap adaptor: top() is the greatest element for comp, use
+    * std::greater for a min-queue. The heap is 4-ary (see heap_detail).
+    *
+    * - Member functions:
+    * (constructor):        Construct priority queue
+    * empty:                Test whether container is empty
+    * size:                 Return size
+    * top:                  Access top element
+    * push:                 Insert element
+    * push_range:           Insert a range, rebuilding the heap when it is
+    *                       cheaper than pushing one by one
+    * pop:                  Remove top element
+    * swap:                 Swap contents
+    * ------------------------------------------------------------- *
+    */
+	template <class T, class Container = ft::vector<T>,
+				class Compare = std::less<typename Container::value_type> >
+	class priority_queue
+	{
+		public:
+			typedef	T									value_type;
+			typedef	Container							container_type;
+			typedef	Compare								value_compare;
+			typedef	typename Container::size_type		size_type;
+			typedef	typename Container::reference		reference;
+			typedef	typename Container::const_reference	const_reference;
+
+		protected:
+			container_type	c;
+			value_compare	comp;
+
+		public:
+			explicit priority_queue ( const value_compare& compare = value_compare(),
+									const container_type& ctnr = container_type() )
+									: c(ctnr), comp(compare) {
+				heap_detail::make_heap(c.begin(), c.size(), comp);
+			}
+
+			template <class InputIterator>
+			priority_queue ( InputIterator first, InputIterator last,
+							const value_compare& compare = value_compare(),
+							const container_type& ctnr = container_type() )
+							: c(ctnr), comp(compare) {
+				c.insert(c.end(), first, last);
+				heap_detail::make_heap(c.begin(), c.size(), comp);
+			}
+
+			bool			empty() const	{ return c.empty(); }
+			size_type		size() const	{ return c.size(); }
+			const_reference	top() const		{ return c.front(); }
+
+			void	push(const value_type& val) {
+				value_type	copy(val);
+
+				c.push_back(copy);
+				heap_detail::sift_up(c.begin(), c.size() - 1, copy, comp);
+			}
+
+			// Appended elements are sifted up one by one while there are fewer
+			// of them than already in the heap, otherwise the whole heap is rebuilt.
+			// push_back keeps the container's amortized growth, insert may not.
+			template <class InputIterator>
+			void	push_range(InputIterator first, InputIterator last) {
+				size_type	old_size = c.size();
+
+				for ( ; first != last; ++first)
+					c.push_back(*first);
+				if (c.size() - old_size > old_size) {
+					heap_detail::make_heap(c.begin(), c.size(), comp);
+					return ;
+				}
+				for (size_type i = old_size; i < c.size(); i++) {
+					value_type	val(c[i]);
+
+					heap_detail::sift_up(c.begin(), i, val, comp);
+				}
+			}
+
+			void	pop() {
+				value_type	last(c.back());
+
+				c.pop_back();
+				if (!c.empty())
+					heap_detail::sift_down(c.begin(), c.size(), 0, last, comp);
+			}
+
+			void	swap(priority_queue& x) {
+				ft::swap(c, x.c);
+				ft::swap(comp, x.comp);
+			}
+	};
+
+	template <class T, class Container, class Compare>
+	void	swap(priority_queue<T,Container,Compare>& x, priority_queue<T,Container,Compare>& y) {
+		x.swap(y);
+	}
+
+	/**
+    * ------------------------------------------------------------- *
+    * ---------------- FT::INDEXED_PRIORITY_QUEUE ----------------- *
+    *
+    * 4-ary max-heap of keys attached to ids in [0, n), with a position
+    * table so a queued key can be changed or removed in O(log n):
+    * with std::greater, update() lowering a key is Dijkstra's
+    * decrease-key. The heap stores (key, id) pairs so sifting only
+    * touches the heap and the position table.
+    *
+    * - Member functions:
+    * (constructor):        Construct for ids below n
+    * empty:                Test whether the queue is empty
+    * size:                 Return number of queued ids
+    * contains:             Test whether an id is queued
+    * key:                  Access the key of a queued id
+    * top:                  Access top key
+    * top_id:               Return the id of the top key
+    * push:                 Queue an id, the id range grows as needed
+    * pop:                  Remove top id
+    * update:               Change the key of a queued id
+    * erase:                Remove a queued id
+    * clear:                Remove all ids
+    * ------------------------------------------------------------- *
+    */
+	template <class T, class Compare = std::less<T> >
+	class indexed_priority_queue
+	{
+		public:
+			typedef	T								value_type;
+			typedef	Compare							value_compare;
+			typedef	size_t							size_type;
+			typedef	ft::pair<value_type, size_type>	entry_type;
+
+			static const size_type	npos = static_cast<size_type>(-1);
+
+		protected:
+			ft::vector<entry_type>	_heap;
+			ft::vector<size_type>	_pos;
+			value_compare			_comp;
+
+		public:
+			explicit indexed_priority_queue ( size_type n = 0, const value_compare& comp = value_compare() )
+											: _pos(n, npos), _comp(comp) { }
+
+			bool				empty() const				{ return _heap.empty(); }
+			size_type			size() const				{ return _heap.size(); }
+			bool				contains(size_type id) const { return id < _pos.size() && _pos[id] != npos; }
+			const value_type&	top() const					{ return _heap.front().first; }
+			size_type			top_id() const				{ return _heap.front().second; }
+
+			const value_type&	key(size_type id) const {
+				if (!contains(id))
+					throw std::out_of_range("ft::indexed_priority_queue");
+				return _heap[_pos[id]].first;
+			}
+
+			// Returns false, leaving the queue unchanged, when id is already queued
+			bool	push(size_type id, const value_type& key) {
+				if (id >= _pos.size())
+					_pos.resize(id + 1, npos);
+				if (_pos[id] != npos)
+					return false;
+				_heap.push_back(entry_type(key, id));
+				_sift_up(_heap.size() - 1, entry_type(key, id));
+				return true;
+			}
+
+			void	pop() {
+				_remove(0);
+			}
+
+			// Moves the id up or down depending on the new key
+			void	update(size_type id, const value_type& key) {
+				if (!contains(id))
+					throw std::out_of_range("ft::indexed_priority_queue");
+				size_type	i = _pos[id];
+				entry_type	e(key, id);
+
+				if (_comp(_heap[i].first, key))
+					_sift_up(i, e);
+				else
+					_sift_down(i, e);
+			}
+
+			bool	erase(size_type id) {
+				if (!contains(id))
+					return false;
+				_remove(_pos[id]);
+				return true;
+			}
+
+			void	clear() {
+				for (size_type i = 0; i < _heap.size(); i++)
+					_pos[_heap[i].second] = npos;
+				_heap.clear();
+			}
+
+		private:
+			// Same as heap_detail, keeping _pos in step with every move
+			void	_place(size_type i, const entry_type& e) {
+				_heap[i] = e;
+				_pos[e.second] = i;
+			}
+
+			void	_sift_up(size_type hole, const entry_type& e) {
+				while (hole > 0 && _comp(_heap[heap_detail::parent(hole)].first, e.first)) {
+					_place(hole, _heap[heap_detail::parent(hole)]);
+					hole = heap_detail::parent(hole);
+				}
+				_place(hole, e);
+			}
+
+			void	_sift_down(size_type hole, const entry_type& e) {
+				size_type	n = _heap.size();
+
+				while (heap_detail::child(hole) < n) {
+					size_type	best = heap_detail::child(hole);
+					size_type	last = best + heap_detail::arity < n ? best + heap_detail::arity : n;
+
+					for (size_type c = best + 1; c < last; c++)
+						if (_comp(_heap[best].first, _heap[c].first))
+							best = c;
+					if (!_comp(e.first, _heap[best].first))
+						break ;
+					_place(hole, _heap[best]);
+					hole = best;
+				}
+				_place(hole, e);
+			}
+
+			// Fills slot i with the last entry, which may have to go either way
+			void	_remove(size_type i) {
+				entry_type	last(_heap.back());
+
+				_pos[_heap[i].second] = npos;
+				_heap.pop_back();
+				if (i == _heap.size())
+					return ;
+				if (i > 0 && _comp(_heap[heap_detail::parent(i)].first, last.first))
+					_sift_up(i, last);
+				else
+					_sift_down(i, last);
+			}
+	};
+
+	template <class T, class Compare>
+	const typename indexed_priority_queue<T,Compare>::size_type	indexed_priority_queue<T,Compare>::npos;
+}
@@ -0,0 +1,79 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   queue.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 21:38:13 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/19 21:38:13 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+# include "deque.hpp"
+
+namespace ft
+{
+	/**
+    * ------------------------------------------------------------- *
+    * ------------------------ FT::QUEUE -------------------------- *
+    *
+    * FIFO adaptor, elements are pushed at the back and popped from
+    * the front, so the container needs pop_front: ft::deque by default.
+    *
+    * - Member functions:
+    * (constructor):        Construct queue
+    * empty:                Test whether container is empty
+    * size:                 Return size
+    * front:                Access next element
+    * back:                 Access last element
+    * push:                 Insert element
+    * pop:                  Remove next element
+    * swap:                 Swap contents
+    *
+    * - Non-member function overloads:
+    * relational operators: Relational operators for queue
+    * swap:                 Exchange contents of two queues
+    * ------------------------------------------------------------- *
+    */
+	template <class T, class Container = ft::deque<T> >
+	class queue
+	{
+		public:
+			typedef	T									value_type;
+			typedef	Container							container_type;
+			typedef	typename Container::size_type		size_type;
+			typedef	typename Container::reference		reference;
+			typedef	typename Container::const_reference	const_reference;
+
+		protected:
+			container_type	c;
+
+		public:
+			explicit queue ( const container_type& ctnr = container_type() ) : c(ctnr) { }
+
+			bool			empty() const					{ return c.empty(); }
+			size_type		size() const					{ return c.size(); }
+			reference		front()							{ return c.front(); }
+			const_reference	front() const					{ return c.front(); }
+			reference		back()							{ return c.back(); }
+			const_reference	back() const					{ return c.back(); }
+			void			push(const value_type& val)		{ c.push_back(val); }
+			void			pop()							{ c.pop_front(); }
+			void			swap(queue& x)					{ ft::swap(c, x.c); }
+
+			friend bool	operator==(const queue& lhs, const queue& rhs)	{ return lhs.c == rhs.c; }
+			friend bool	operator!=(const queue& lhs, const queue& rhs)	{ return lhs.c != rhs.c; }
+			friend bool	operator<(const queue& lhs, const queue& rhs)	{ return lhs.c < rhs.c; }
+			friend bool	operator<=(const queue& lhs, const queue& rhs)	{ return lhs.c <= rhs.c; }
+			friend bool	operator>(const queue& lhs, const queue& rhs)	{ return lhs.c > rhs.c; }
+			friend bool	operator>=(const queue& lhs, const queue& rhs)	{ return lhs.c >= rhs.c; }
+	};
+
+	template <class T, class Container>
+	void	swap(queue<T,Container>& x, queue<T,Container>& y) {
+		x.swap(y);
+	}
+}
@@ -0,0 +1,492 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ring.hpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 07:34:54 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/21 08:00:03 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+# include <memory>
+# include <stdexcept>
+# include <limits>
+# include <climits>
+# include <stddef.h>
+# include <stdint.h>
+# include <sched.h>
+# ifdef __linux__
+#  include <unistd.h>
+#  include <sys/syscall.h>
+#  include <linux/futex.h>
+# endif
+
+namespace ft
+{
+	/**
+    * ------------------------------------------------------------- *
+    * ------------------- FT::SPSC_RING / MPMC_RING --------------- *
+    *
+    * Bounded queues over a ring of capacity slots, fixed at
+    * construction (rounded up to a power of two). The producer and
+    * consumer indices sit on cache lines of their own.
+    *
+    * spsc_ring:            One producer thread, one consumer thread.
+    *                       Each side keeps a copy of the other's index
+    *                       and rereads it only when the ring looks full
+    *                       (or empty), so most operations touch no
+    *                       shared line but the slot.
+    * mpmc_ring:            Any number of both. Every slot carries a
+    *                       sequence number telling which lap may write
+    *                       or read it next (Vyukov's bounded queue);
+    *                       a compare-and-swap on the index claims slots.
+    *
+    * - Operations:
+    * try_push, try_pop:    One element, false when full (empty)
+    * try_push_n:           Up to n elements in one claim, returns how
+    * try_pop_n:            many went through
+    * push, pop:            Block until done
+    * push_n:               Blocks until all n are in
+    * pop_n:                Blocks until at least one is out
+    * size, empty:          A snapshot, exact only when no one moves
+    * capacity:             Number of slots
+    *
+    * Blocking calls wait through the Wait policy:
+    * spin_wait:            Busy loop, lowest latency, needs a CPU per
+    *                       waiting thread
+    * yield_wait:           sched_yield between attempts
+    * futex_wait:           Sleeps in the kernel (Linux futex, yield
+    *                       elsewhere); the other side only makes a
+    *                       system call when someone is asleep
+    *
+    * Copying an element in or out of an mpmc_ring must not throw: a
+    * claimed slot has to be handed on.
+    * ------------------------------------------------------------- *
+    */
+
+	static const size_t	cache_line = 64;
+
+	inline void	cpu_relax() {
+# if defined(__x86_64__) || defined(__i386__)
+		__builtin_ia32_pause();
+# endif
+	}
+
+	/* ------------------------------------------------------------- */
+	/**
+	*   Wait policies. A blocked call does
+	*       key = prepare(); if (retry succeeds) cancel(); else wait(key);
+	*   and the other side calls notify() after every change.
+	*/
+	/* ------------------------------------------------------------- */
+
+	struct spin_wait
+	{
+		unsigned	prepare() { return 0; }
+		void		cancel() { }
+		void		wait(unsigned) {
+			for (int i = 0; i < 64; i++)
+				cpu_relax();
+		}
+		void		notify() { }
+	};
+
+	struct yield_wait
+	{
+		unsigned	prepare() { return 0; }
+		void		cancel() { }
+		void		wait(unsigned) { sched_yield(); }
+		void		notify() { }
+	};
+
+	class futex_wait
+	{
+		public:
+			futex_wait() : _seq(0), _waiters(0) { }
+
+			unsigned	prepare() {
+				__atomic_add_fetch(&_waiters, 1, __ATOMIC_SEQ_CST);
+				return __atomic_load_n(&_seq, __ATOMIC_SEQ_CST);
+			}
+			void		cancel() { __atomic_sub_fetch(&_waiters, 1, __ATOMIC_RELAXED); }
+				// Returns at once if a notify() came since prepare()
+			void		wait(unsigned key) {
+# ifdef __linux__
+				syscall(SYS_futex, &_seq, FUTEX_WAIT_PRIVATE, key, NULL, NULL, 0);
+# else
+				(void)key;
+				sched_yield();
+# endif
+				cancel();
+			}
+			void		notify() {
+				__atomic_thread_fence(__ATOMIC_SEQ_CST);
+				if (__atomic_load_n(&_waiters, __ATOMIC_RELAXED) != 0) {
+					__atomic_add_fetch(&_seq, 1, __ATOMIC_SEQ_CST);
+# ifdef __linux__
+					syscall(SYS_futex, &_seq, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+# endif
+				}
+			}
+
+		private:
+			unsigned	_seq;
+			unsigned	_waiters;
+
+			futex_wait(const futex_wait&);
+			futex_wait&	operator=(const futex_wait&);
+	};
+
+	namespace ring_detail
+	{
+		inline size_t	round_capacity(size_t n) {
+			size_t	cap = 1;
+
+			if (n > (std::numeric_limits<size_t>::max() >> 2) + 1)
+				throw std::length_error("ft::ring");
+			while (cap < n)
+				cap <<= 1;
+			return cap;
+		}
+	}
+
+	/* ------------------------------------------------------------- */
+	/* -------------------------- SPSC_RING ------------------------ */
+
+	template <class T, class Wait = yield_wait, class Allocator = std::allocator<T> >
+	class spsc_ring
+	{
+		public:
+			typedef T			value_type;
+			typedef Allocator	allocator_type;
+			typedef size_t		size_type;
+
+			explicit spsc_ring(size_type capacity, const allocator_type& alloc = allocator_type())
+				: _alloc(alloc), _mask(ring_detail::round_capacity(capacity) - 1) {
+				_buf = _alloc.allocate(_mask + 1);
+				_prod.index = 0;
+				_prod.cached = 0;
+				_cons.index = 0;
+				_cons.cached = 0;
+			}
+
+			~spsc_ring() {
+				for (size_type i = _cons.index; i != _prod.index; i++)
+					_alloc.destroy(_buf + (i & _mask));
+				_alloc.deallocate(_buf, _mask + 1);
+			}
+
+			/* ------------------------------------------------------------- */
+			/* ------------------------- PRODUCER -------------------------- */
+
+			bool	try_push(const value_type& x) { return try_push_n(&x, 1) == 1; }
+
+			size_type	try_push_n(const value_type* first, size_type n) {
+				size_type	tail = _prod.index;
+				size_type	room = _mask + 1 - (tail - _prod.cached);
+
+				if (room < n) {
+					_prod.cached = __atomic_load_n(&_cons.index, __ATOMIC_ACQUIRE);
+					room = _mask + 1 - (tail - _prod.cached);
+				}
+				if (n > room)
+					n = room;
+				if (n == 0)
+					return 0;
+				for (size_type i = 0; i < n; i++) {
+					try {
+						_alloc.construct(_buf + ((tail + i) & _mask), first[i]);
+					}
+					catch (...) {
+						if (i == 0)
+							throw;
+						n = i;
+						break;
+					}
+				}
+				__atomic_store_n(&_prod.index, tail + n, __ATOMIC_RELEASE);
+				_not_empty.notify();
+				return n;
+			}
+
+			void	push(const value_type& x) { push_n(&x, 1); }
+
+			void	push_n(const value_type* first, size_type n) {
+				while (n != 0) {
+					size_type	k = try_push_n(first, n);
+
+					if (k == 0) {
+						unsigned	key = _not_full.prepare();
+
+						if ((k = try_push_n(first, n)) != 0)
+							_not_full.cancel();
+						else
+							_not_full.wait(key);
+					}
+					first += k;
+					n -= k;
+				}
+			}
+
+			/* ------------------------------------------------------------- */
+			/* ------------------------- CONSUMER -------------------------- */
+
+			bool	try_pop(value_type& out) { return try_pop_n(&out, 1) == 1; }
+
+			size_type	try_pop_n(value_type* out, size_type max) {
+				size_type	head = _cons.index;
+				size_type	n = _cons.cached - head;
+
+				if (n < max) {
+					_cons.cached = __atomic_load_n(&_prod.index, __ATOMIC_ACQUIRE);
+					n = _cons.cached - head;
+				}
+				if (n > max)
+					n = max;
+				if (n == 0)
+					return 0;
+				for (size_type i = 0; i < n; i++) {
+					value_type*	slot = _buf + ((head + i) & _mask);
+
+					try {
+						out[i] = *slot;
+					}
+					catch (...) {
+						if (i == 0)
+							throw;
+						n = i;
+						break;
+					}
+					_alloc.destroy(slot);
+				}
+				__atomic_store_n(&_cons.index, head + n, __ATOMIC_RELEASE);
+				_not_full.notify();
+				return n;
+			}
+
+			void	pop(value_type& out) { pop_n(&out, 1); }
+
+			size_type	pop_n(value_type* out, size_type max) {
+				size_type	n = 0;
+
+				while (max != 0 && (n = try_pop_n(out, max)) == 0) {
+					unsigned	key = _not_empty.prepare();
+
+					if ((n = try_pop_n(out, max)) != 0) {
+						_not_empty.cancel();
+						return n;
+					}
+					_not_empty.wait(key);
+				}
+				return max == 0 ? 0 : n;
+			}
+
+			/* ------------------------------------------------------------- */
+
+			size_type	size() const {
+				size_type	head = __atomic_load_n(&_cons.index, __ATOMIC_ACQUIRE);
+
+				return __atomic_load_n(&_prod.index, __ATOMIC_ACQUIRE) - head;
+			}
+			bool		empty() const { return size() == 0; }
+			size_type	capacity() const { return _mask + 1; }
+
+		private:
+				// index is the side's own, cached its last look at the other's
+			struct alignas(cache_line) side
+			{
+				size_type	index;
+				size_type	cached;
+			};
+
+			allocator_type	_alloc;
+			value_type*		_buf;
+			size_type		_mask;
+			side			_prod;
+			side			_cons;
+			alignas(cache_line) Wait	_not_empty;
+			alignas(cache_line) Wait	_not_full;
+
+			spsc_ring(const spsc_ring&);
+			spsc_ring&	operator=(const spsc_ring&);
+	};
+
+	/* ------------------------------------------------------------- */
+	/* -------------------------- MPMC_RING ------------------------ */
+
+	template <class T, class Wait = yield_wait, class Allocator = std::allocator<T> >
+	class mpmc_ring
+	{
+		public:
+			typedef T			value_type;
+			typedef Allocator	allocator_type;
+			typedef size_t		size_type;
+
+			explicit mpmc_ring(size_type capacity, const allocator_type& alloc = allocator_type())
+				: _alloc(alloc), _seq_alloc(alloc), _mask(ring_detail::round_capacity(capacity) - 1) {
+				_buf = _alloc.allocate(_mask + 1);
+				try {
+					_seq = _seq_alloc.allocate(_mask + 1);
+				}
+				catch (...) {
+					_alloc.deallocate(_buf, _mask + 1);
+					throw;
+				}
+				for (size_type i = 0; i <= _mask; i++)
+					_seq[i] = i;
+				_tail.index = 0;
+				_head.index = 0;
+			}
+
+			~mpmc_ring() {
+				for (size_type i = _head.index; i != _tail.index; i++)
+					_alloc.destroy(_buf + (i & _mask));
+				_seq_alloc.deallocate(_seq, _mask + 1);
+				_alloc.deallocate(_buf, _mask + 1);
+			}
+
+			/* ------------------------------------------------------------- */
+			/* ------------------------- PRODUCER -------------------------- */
+
+			bool	try_push(const value_type& x) { return try_push_n(&x, 1) == 1; }
+
+				// Claims the run of free slots at the tail, up to n, with one
+				// compare-and-swap: a slot is free for position p once its
+				// sequence is p, and nobody else can take it while tail is ours
+			size_type	try_push_n(const value_type* first, size_type n) {
+				size_type	pos = __atomic_load_n(&_tail.index, __ATOMIC_RELAXED);
+				size_type	k;
+
+				for (;;) {
+					for (k = 0; k < n && __atomic_load_n(&_seq[(pos + k) & _mask], __ATOMIC_ACQUIRE) == pos + k; k++)
+						;
+					if (k == 0) {
+						size_type	now = __atomic_load_n(&_tail.index, __ATOMIC_RELAXED);
+
+						if (now == pos)
+							return 0;
+						pos = now;
+						continue;
+					}
+					if (__atomic_compare_exchange_n(&_tail.index, &pos, pos + k, true,
+													__ATOMIC_RELAXED, __ATOMIC_RELAXED))
+						break;
+				}
+				for (size_type i = 0; i < k; i++) {
+					_alloc.construct(_buf + ((pos + i) & _mask), first[i]);
+					__atomic_store_n(&_seq[(pos + i) & _mask], pos + i + 1, __ATOMIC_RELEASE);
+				}
+				_not_empty.notify();
+				return k;
+			}
+
+			void	push(const value_type& x) { push_n(&x, 1); }
+
+			void	push_n(const value_type* first, size_type n) {
+				while (n != 0) {
+					size_type	k = try_push_n(first, n);
+
+					if (k == 0) {
+						unsigned	key = _not_full.prepare();
+
+						if ((k = try_push_n(first, n)) != 0)
+							_not_full.cancel();
+						else
+							_not_full.wait(key);
+					}
+					first += k;
+					n -= k;
+				}
+			}
+
+			/* ------------------------------------------------------------- */
+			/* ------------------------- CONSUMER -------------------------- */
+
+			bool	try_pop(value_type& out) { return try_pop_n(&out, 1) == 1; }
+
+				// Same at the head: position p is readable once its sequence
+				// is p + 1, and is handed back to the next lap as p + capacity
+			size_type	try_pop_n(value_type* out, size_type max) {
+				size_type	pos = __atomic_load_n(&_head.index, __ATOMIC_RELAXED);
+				size_type	k;
+
+				for (;;) {
+					for (k = 0; k < max && __atomic_load_n(&_seq[(pos + k) & _mask], __ATOMIC_ACQUIRE) == pos + k + 1; k++)
+						;
+					if (k == 0) {
+						size_type	now = __atomic_load_n(&_head.index, __ATOMIC_RELAXED);
+
+						if (now == pos)
+							return 0;
+						pos = now;
+						continue;
+					}
+					if (__atomic_compare_exchange_n(&_head.index, &pos, pos + k, true,
+													__ATOMIC_RELAXED, __ATOMIC_RELAXED))
+						break;
+				}
+				for (size_type i = 0; i < k; i++) {
+					value_type*	slot = _buf + ((pos + i) & _mask);
+
+					out[i] = *slot;
+					_alloc.destroy(slot);
+					__atomic_store_n(&_seq[(pos + i) & _mask], pos + i + _mask + 1, __ATOMIC_RELEASE);
+				}
+				_not_full.notify();
+				return k;
+			}
+
+			void	pop(value_type& out) { pop_n(&out, 1); }
+
+			size_type	pop_n(value_type* out, size_type max) {
+				size_type	n = 0;
+
+				while (max != 0 && (n = try_pop_n(out, max)) == 0) {
+					unsigned	key = _not_empty.prepare();
+
+					if ((n = try_pop_n(out, max)) != 0) {
+						_not_empty.cancel();
+						return n;
+					}
+					_not_empty.wait(key);
+				}
+				return max == 0 ? 0 : n;
+			}
+
+			/* ------------------------------------------------------------- */
+
+			size_type	size() const {
+				size_type	head = __atomic_load_n(&_head.index, __ATOMIC_ACQUIRE);
+				size_type	tail = __atomic_load_n(&_tail.index, __ATOMIC_ACQUIRE);
+
+				return tail > head ? tail - head : 0;
+			}
+			bool		empty() const { return size() == 0; }
+			size_type	capacity() const { return _mask + 1; }
+
+		private:
+			typedef typename Allocator::template rebind<size_type>::other	seq_allocator;
+
+			struct alignas(cache_line) side
+			{
+				size_type	index;
+			};
+
+			allocator_type	_alloc;
+			seq_allocator	_seq_alloc;
+			value_type*		_buf;
+			size_type*		_seq;
+			size_type		_mask;
+			side			_tail;
+			side			_head;
+			alignas(cache_line) Wait	_not_empty;
+			alignas(cache_line) Wait	_not_full;
+
+			mpmc_ring(const mpmc_ring&);
+			mpmc_ring&	operator=(const mpmc_ring&);
+	};
+}
@@ -0,0 +1,441 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   segmented_vector.hpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 17:50:53 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/22 14:02:11 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+# include <limits>
+# include <stdexcept>
+# include "iterators/SegmentedIterator.hpp"
+# include "algorithm.hpp"
+# include "type_traits.hpp"
+
+namespace ft
+{
+	/**
+    * ------------------------------------------------------------- *
+    * -------------------- FT::SEGMENTED_VECTOR ------------------- *
+    *
+    * Elements live in segments of 16, 32, 64... elements whose
+    * addresses are kept in a table that is allocated with the
+    * container and never moves. Growing appends the next segment,
+    * so push_back never copies an element and pointers, references
+    * and iterators stay valid until the element is removed. The
+    * segment of an index is found with one count-leading-zeros, so
+    * access is O(1). Only the back can be changed: there is no
+    * insert or erase.
+    *
+    * - Coplien form:
+    * (constructor):        Construct segmented_vector
+    * (destructor):         Destruct segmented_vector
+    * operator=:            Assign segmented_vector
+    *
+    * - Iterators:
+    * begin:                Return iterator to beginning
+    * end:                  Return iterator to end
+    * rbegin:               Return reverse iterator to reverse beginning
+    * rend:                 Return reverse iterator to reverse end
+    *
+    * - Capacity:
+    * size:                 Return size
+    * max_size:             Return maximum size
+    * resize:               Change size
+    * capacity:             Return size of allocated storage capacity
+    * empty:                Test whether segmented_vector is empty
+    * reserve:              Allocate segments up to a capacity
+    * shrink_to_fit:        Free the unused segments
+    *
+    * - Element access:
+    * operator[]:           Access element
+    * at:                   Access element
+    * front:                Access first element
+    * back:                 Access last element
+    *
+    * - Modifiers:
+    * assign:               Assign segmented_vector content
+    * push_back:            Add element at the end
+    * pop_back:             Delete last element
+    * swap:                 Swap content
+    * clear:                Clear content
+    *
+    * - Non-member function overloads:
+    * relational operators: Relational operators for segmented_vector
+    * swap:                 Exchange contents of two segmented_vectors
+    * ------------------------------------------------------------- *
+    */
+	template<class T, class Allocator = std::allocator<T> >
+	class segmented_vector
+	{
+		public:
+			/* ------------------------------------------------------------- */
+    	    /* -------------------------- ALIASES -------------------------- */
+			typedef	T											value_type;
+			typedef	Allocator									allocator_type;
+			typedef	typename allocator_type::size_type			size_type;
+			typedef typename allocator_type::difference_type	difference_type;
+			typedef	typename allocator_type::reference			reference;
+			typedef	typename allocator_type::const_reference	const_reference;
+			typedef	typename allocator_type::pointer			pointer;
+			typedef	typename allocator_type::const_pointer		const_pointer;
+			typedef	ft::SegmentedIterator<value_type>			iterator;
+			typedef	ft::SegmentedIterator<const value_type>		const_iterator;
+			typedef	ft::reverse_iterator<iterator>				reverse_iterator;
+			typedef	ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+
+		protected:
+			typedef typename Allocator::template rebind<pointer>::other	table_allocator;
+			typedef pointer*											table_pointer;
+
+    	    /* ------------------------------------------------------------- */
+    	    /* ------------------------- ATTRIBUTES ------------------------ */
+			allocator_type	_alloc;
+			table_allocator	_table_alloc;
+			table_pointer	_table;
+			size_type		_segments;
+			size_type		_size;
+
+		public:
+    	    /* ------------------------------------------------------------- */
+    	    /* ---------------------------- BODY --------------------------- */
+
+ 			/* ------------------------------------------------------------- */
+            /**
+            *   Default constructor, creates an empty segmented_vector. Only
+            *   the segment table is allocated, so that even the iterators of
+            *   an empty segmented_vector survive its growth.
+            *
+            *   @param alloc    The template param used for the allocation.
+            */
+            /* ------------------------------------------------------------- */
+
+			explicit segmented_vector ( const allocator_type& alloc = allocator_type() )
+							: _alloc(alloc), _table_alloc(alloc), _table(_new_table()), _segments(0), _size(0) { }
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Fill constructor, creates a segmented_vector of n copies of val.
+            */
+            /* ------------------------------------------------------------- */
+
+			explicit segmented_vector ( size_type n, const value_type& val = value_type(),
+							const allocator_type& alloc = allocator_type() )
+								: _alloc(alloc), _table_alloc(alloc), _table(_new_table()), _segments(0), _size(0) {
+				assign(n, val);
+			}
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Range constructor, copies the elements of [first, last).
+            */
+            /* ------------------------------------------------------------- */
+
+			template <class InputIterator>
+			segmented_vector ( InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type * = NULL)
+					: _alloc(alloc), _table_alloc(alloc), _table(_new_table()), _segments(0), _size(0) {
+				assign(first, last);
+			}
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Copy constructor.
+            */
+            /* ------------------------------------------------------------- */
+
+			segmented_vector ( const segmented_vector& x )
+					: _alloc(x._alloc), _table_alloc(x._table_alloc), _table(_new_table()), _segments(0), _size(0) {
+				reserve(x.size());
+				assign(x.begin(), x.end());
+			}
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Destructor, destroys all the elements and frees the segments and the table.
+            */
+            /* ------------------------------------------------------------- */
+
+			~segmented_vector() {
+				clear();
+				_release(0);
+				_table_alloc.deallocate(_table, segments::max_count);
+			}
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Assigns a segmented_vector to this one, reusing the elements in place.
+            */
+            /* ------------------------------------------------------------- */
+
+			segmented_vector& operator=( const segmented_vector& x ) {
+				if (this == &x)
+					return *this;
+				if (x.size() < size())
+					_destroy_tail(size() - x.size());
+				reserve(x.size());
+				const_iterator	src = x.begin();
+				for (iterator dst = begin(); dst != end(); ++dst, ++src)
+					*dst = *src;
+				for ( ; src != x.end(); ++src)
+					push_back(*src);
+				return *this;
+			}
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Fill and range assign, replace the content of the segmented_vector.
+            */
+            /* ------------------------------------------------------------- */
+
+			void	assign(size_type count, const value_type& val) {
+				value_type	copy(val);
+
+				clear();
+				reserve(count);
+				for ( ; count != 0; --count)
+					push_back(copy);
+			}
+
+			template <class InputIterator>
+			void	assign(InputIterator first, InputIterator last,
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type * = NULL) {
+				clear();
+				for ( ; first != last; ++first)
+					push_back(*first);
+			}
+
+			/* ------------------------------------------------------------- */
+
+			allocator_type	get_allocator() const { return _alloc; }
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Element access, O(1): one clz to find the segment.
+            */
+            /* ------------------------------------------------------------- */
+
+			reference	at(size_type pos) {
+				if (pos >= _size)
+					throw std::out_of_range("ft::segmented_vector");
+				return (*this)[pos];
+			}
+
+			const_reference	at(size_type pos) const {
+				if (pos >= _size)
+					throw std::out_of_range("ft::segmented_vector");
+				return (*this)[pos];
+			}
+
+			reference		operator[](size_type pos)		{ return segments::at(_table, pos); }
+			const_reference	operator[](size_type pos) const	{ return segments::at(_table, pos); }
+			reference 		front()							{ return _table[0][0]; }
+			const_reference front() const					{ return _table[0][0]; }
+			reference		back() 							{ return (*this)[_size - 1]; }
+			const_reference	back() const					{ return (*this)[_size - 1]; }
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Iterators
+            */
+            /* ------------------------------------------------------------- */
+
+			iterator				begin()			{ return iterator(_table, 0); }
+			const_iterator 			begin() const	{ return const_iterator(_table, 0); }
+			iterator				end()			{ return iterator(_table, _size); }
+			const_iterator			end() const 	{ return const_iterator(_table, _size); }
+			reverse_iterator		rbegin()		{ return reverse_iterator(end()); }
+			const_reverse_iterator	rbegin() const	{ return const_reverse_iterator(end()); }
+			reverse_iterator		rend()			{ return reverse_iterator(begin()); }
+			const_reverse_iterator	rend() const	{ return const_reverse_iterator(begin()); }
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Capacity
+            */
+            /* ------------------------------------------------------------- */
+
+			bool		empty() const		{ return _size == 0; }
+			size_type	size() const		{ return _size; }
+			size_type	capacity() const	{ return segments::first_of(_segments); }
+
+			size_type	max_size() const {
+				size_type _amax = _alloc.max_size();
+				size_type _nmax = std::numeric_limits<size_type>::max() / 2;
+				if (_amax < _nmax)
+					return _amax;
+				return _nmax;
+			}
+
+			/* ------------------------------------------------------------- */
+
+			// Appends segments until new_cap fits; nothing is moved
+			void	reserve(size_type new_cap) {
+				if (new_cap > max_size())
+					throw std::length_error("ft::segmented_vector");
+				while (capacity() < new_cap)
+					_add_segment();
+			}
+
+			/* ------------------------------------------------------------- */
+
+			// Frees the segments past the one holding the last element
+			void	shrink_to_fit() {
+				size_type	keep = _size == 0 ? 0 : segments::index_of(_size - 1) + 1;
+
+				_release(keep);
+			}
+
+			/* ------------------------------------------------------------- */
+
+			void	resize(size_type n, value_type val = value_type()) {
+				if (n < _size)
+					_destroy_tail(_size - n);
+				else {
+					reserve(n);
+					while (_size < n)
+						push_back(val);
+				}
+			}
+
+            /* ------------------------------------------------------------- */
+            /**
+            *     Modifiers
+            */
+            /* ------------------------------------------------------------- */
+
+			// val may be one of the elements: adding a segment moves none,
+			// so it needs no copy
+			void	push_back(const value_type& val) {
+				if (_size == capacity())
+					_add_segment();
+				_alloc.construct(&(*this)[_size], val);
+				++_size;
+			}
+
+			/* ------------------------------------------------------------- */
+
+			void	pop_back() {
+				--_size;
+				_alloc.destroy(&(*this)[_size]);
+			}
+
+			/* ------------------------------------------------------------- */
+
+			void	swap(segmented_vector& x) {
+				ft::swap(_alloc, x._alloc);
+				ft::swap(_table_alloc, x._table_alloc);
+				ft::swap(_table, x._table);
+				ft::swap(_segments, x._segments);
+				ft::swap(_size, x._size);
+			}
+
+			/* ------------------------------------------------------------- */
+
+			// Keeps the segments for the next insertions
+			void	clear() {
+				_destroy_tail(_size);
+			}
+
+            /* ------------------------------------------------------------- */
+            /**
+            *      PRIVATE Utils functions
+            */
+            /* ------------------------------------------------------------- */
+		private:
+			// The table has a slot for every possible segment, so it is
+			// allocated once, by the constructors
+			table_pointer	_new_table() {
+				table_pointer	table = _table_alloc.allocate(segments::max_count);
+
+				for (size_type k = 0; k < segments::max_count; k++)
+					table[k] = nullptr;
+				return table;
+			}
+
+			/* ------------------------------------------------------------- */
+
+			void	_add_segment() {
+				if (_segments == segments::max_count)
+					throw std::length_error("ft::segmented_vector");
+				_table[_segments] = _alloc.allocate(segments::size_of(_segments));
+				++_segments;
+			}
+
+			/* ------------------------------------------------------------- */
+
+			// Frees the segments from keep on, the table stays
+			void	_release(size_type keep) {
+				for ( ; _segments > keep; --_segments) {
+					_alloc.deallocate(_table[_segments - 1], segments::size_of(_segments - 1));
+					_table[_segments - 1] = nullptr;
+				}
+			}
+
+			/* ------------------------------------------------------------- */
+
+			// Destroys the last n elements, segment by segment
+			void	_destroy_tail(size_type n) {
+				size_type	last = _size;
+
+				_size -= n;
+				if (ft::is_trivially_destructible<value_type>::value)
+					return ;
+				while (last > _size) {
+					size_type	k = segments::index_of(last - 1);
+					size_type	base = segments::first_of(k);
+					size_type	first = base < _size ? _size : base;
+					for (pointer p = _table[k] + (last - base); p != _table[k] + (first - base); )
+						_alloc.destroy(--p);
+					last = first;
+				}
+			}
+	};
+
+	template <class T, class Alloc>
+	void	swap(segmented_vector<T,Alloc>& x, segmented_vector<T,Alloc>& y) {
+		x.swap(y);
+	}
+
+    /* ------------------------------------------------------------- */
+    /**
+    *   Relational operators
+    */
+    /* ------------------------------------------------------------- */
+
+	template <class T, class Alloc>
+	bool operator==(const segmented_vector<T,Alloc>& lhs, const segmented_vector<T,Alloc>& rhs) {
+		return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+
+	template <class T, class Alloc>
+	bool operator<(const segmented_vector<T,Alloc>& lhs, const segmented_vector<T,Alloc>& rhs) {
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	}
+
+	template <class T, class Alloc>
+	bool	operator>(const segmented_vector<T,Alloc>& lhs, const segmented_vector<T,Alloc>& rhs) {
+		return rhs < lhs;
+	}
+
+	template <class T, class Alloc>
+	bool	operator!=(const segmented_vector<T,Alloc>& lhs, const segmented_vector<T,Alloc>& rhs) {
+		return !(lhs == rhs);
+	}
+
+	template <class T, class Alloc>
+	bool	operator<=(const segmented_vector<T,Alloc>& lhs, const segmented_vector<T,Alloc>& rhs) {
+		return !(rhs < lhs);
+	}
+
+	template <class T, class Alloc>
+	bool	operator>=(const segmented_vector<T,Alloc>& lhs, const segmented_vector<T,Alloc>& rhs) {
+		return !(lhs < rhs);
+	}
+}
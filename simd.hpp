@@ -0,0 +1,283 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   simd.hpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:34:07 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/21 05:49:56 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+# include <cstring>
+# include <stddef.h>
+# include <stdint.h>
+# if defined(__x86_64__) || defined(__i386__)
+#  include <immintrin.h>
+#  define FT_SIMD_X86 1
+# endif
+
+namespace ft
+{
+	/**
+    * ------------------------------------------------------------- *
+    * -------------------------- FT::SIMD ------------------------- *
+    *
+    * Comparison kernels for contiguous arrays of integers and
+    * floating point numbers, used by ft::equal and
+    * ft::lexicographical_compare. The widest instruction set the CPU
+    * supports is picked once at runtime (AVX2, SSE2, scalar).
+    *
+    * Integers compare equal exactly when their bytes do, so they go
+    * through memcmp or a byte mismatch search. Floats and doubles use
+    * IEEE comparisons (0.0 == -0.0, NaN != NaN).
+    *
+    * popcount counts the set bits of an array of words, with the
+    * POPCNT instruction when the CPU has it.
+    * ------------------------------------------------------------- *
+    */
+
+	namespace simd
+	{
+		enum level { SCALAR, SSE2, AVX2 };
+
+		inline level	cpu_level() {
+# ifdef FT_SIMD_X86
+			static const level	detected = (__builtin_cpu_init(), __builtin_cpu_supports("avx2") ? AVX2
+											: __builtin_cpu_supports("sse2") ? SSE2 : SCALAR);
+			return detected;
+# else
+			return SCALAR;
+# endif
+		}
+
+		/* ------------------------------------------------------------- */
+		/**
+		*   Index of the first differing byte, n if there is none.
+		*/
+		/* ------------------------------------------------------------- */
+
+		inline size_t	mismatch_bytes_scalar(const unsigned char *a, const unsigned char *b, size_t n) {
+			size_t	i = 0;
+
+			for (uint64_t x, y; i + 8 <= n; i += 8) {
+				memcpy(&x, a + i, 8);
+				memcpy(&y, b + i, 8);
+				if (x != y)
+					break;
+			}
+			for ( ; i < n && a[i] == b[i]; i++)
+				;
+			return i;
+		}
+
+# ifdef FT_SIMD_X86
+		__attribute__((target("sse2")))
+		inline size_t	mismatch_bytes_sse2(const unsigned char *a, const unsigned char *b, size_t n) {
+			size_t	i = 0;
+
+			for ( ; i + 16 <= n; i += 16) {
+				__m128i		x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+				__m128i		y = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i));
+				unsigned	diff = _mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) ^ 0xffffU;
+				if (diff)
+					return i + __builtin_ctz(diff);
+			}
+			return i + mismatch_bytes_scalar(a + i, b + i, n - i);
+		}
+
+		__attribute__((target("avx2")))
+		inline size_t	mismatch_bytes_avx2(const unsigned char *a, const unsigned char *b, size_t n) {
+			size_t	i = 0;
+
+			for ( ; i + 32 <= n; i += 32) {
+				__m256i		x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+				__m256i		y = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+				unsigned	diff = ~static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)));
+				if (diff)
+					return i + __builtin_ctz(diff);
+			}
+			return i + mismatch_bytes_sse2(a + i, b + i, n - i);
+		}
+
+		__attribute__((target("sse2")))
+		inline size_t	mismatch_sse2(const float *a, const float *b, size_t n) {
+			size_t	i = 0;
+
+			for ( ; i + 4 <= n; i += 4) {
+				unsigned	diff = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i))) ^ 0xfU;
+				if (diff)
+					return i + __builtin_ctz(diff);
+			}
+			for ( ; i < n && a[i] == b[i]; i++)
+				;
+			return i;
+		}
+
+		__attribute__((target("avx2")))
+		inline size_t	mismatch_avx2(const float *a, const float *b, size_t n) {
+			size_t	i = 0;
+
+			for ( ; i + 8 <= n; i += 8) {
+				__m256		eq = _mm256_cmp_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), _CMP_EQ_OQ);
+				unsigned	diff = _mm256_movemask_ps(eq) ^ 0xffU;
+				if (diff)
+					return i + __builtin_ctz(diff);
+			}
+			return i + mismatch_sse2(a + i, b + i, n - i);
+		}
+
+		__attribute__((target("sse2")))
+		inline size_t	mismatch_sse2(const double *a, const double *b, size_t n) {
+			size_t	i = 0;
+
+			for ( ; i + 2 <= n; i += 2) {
+				unsigned	diff = _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i))) ^ 0x3U;
+				if (diff)
+					return i + __builtin_ctz(diff);
+			}
+			for ( ; i < n && a[i] == b[i]; i++)
+				;
+			return i;
+		}
+
+		__attribute__((target("avx2")))
+		inline size_t	mismatch_avx2(const double *a, const double *b, size_t n) {
+			size_t	i = 0;
+
+			for ( ; i + 4 <= n; i += 4) {
+				__m256d		eq = _mm256_cmp_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), _CMP_EQ_OQ);
+				unsigned	diff = _mm256_movemask_pd(eq) ^ 0xfU;
+				if (diff)
+					return i + __builtin_ctz(diff);
+			}
+			return i + mismatch_sse2(a + i, b + i, n - i);
+		}
+# endif
+
+		/* ------------------------------------------------------------- */
+		/**
+		*   Index of the first i with !(a[i] == b[i]), n if there is none.
+		*/
+		/* ------------------------------------------------------------- */
+
+		inline size_t	mismatch_bytes(const unsigned char *a, const unsigned char *b, size_t n) {
+# ifdef FT_SIMD_X86
+			switch (cpu_level()) {
+				case AVX2:	return mismatch_bytes_avx2(a, b, n);
+				case SSE2:	return mismatch_bytes_sse2(a, b, n);
+				default:	break;
+			}
+# endif
+			return mismatch_bytes_scalar(a, b, n);
+		}
+
+		template <class T>
+		size_t	mismatch(const T *a, const T *b, size_t n) {
+			return mismatch_bytes(reinterpret_cast<const unsigned char *>(a),
+								reinterpret_cast<const unsigned char *>(b), n * sizeof(T)) / sizeof(T);
+		}
+
+		template <class T>
+		size_t	mismatch_float(const T *a, const T *b, size_t n) {
+# ifdef FT_SIMD_X86
+			switch (cpu_level()) {
+				case AVX2:	return mismatch_avx2(a, b, n);
+				case SSE2:	return mismatch_sse2(a, b, n);
+				default:	break;
+			}
+# endif
+			size_t	i = 0;
+			for ( ; i < n && a[i] == b[i]; i++)
+				;
+			return i;
+		}
+
+		inline size_t	mismatch(const float *a, const float *b, size_t n) { return mismatch_float(a, b, n); }
+		inline size_t	mismatch(const double *a, const double *b, size_t n) { return mismatch_float(a, b, n); }
+
+		/* ------------------------------------------------------------- */
+		/**
+		*   equal: memcmp for integers, IEEE comparison for floats.
+		*/
+		/* ------------------------------------------------------------- */
+
+		template <class T>
+		bool	equal(const T *a, const T *b, size_t n) {
+			return n == 0 || memcmp(a, b, n * sizeof(T)) == 0;
+		}
+
+		inline bool	equal(const float *a, const float *b, size_t n) { return mismatch(a, b, n) == n; }
+		inline bool	equal(const double *a, const double *b, size_t n) { return mismatch(a, b, n) == n; }
+
+		/* ------------------------------------------------------------- */
+		/**
+		*   lexicographical_compare: jumps from mismatch to mismatch. Only
+		*   NaNs can mismatch without ordering, then the search resumes.
+		*/
+		/* ------------------------------------------------------------- */
+
+		template <class T>
+		bool	lexicographical_compare(const T *a, size_t n1, const T *b, size_t n2) {
+			size_t	n = n1 < n2 ? n1 : n2;
+
+			for (size_t i = mismatch(a, b, n); i < n; i += 1 + mismatch(a + i + 1, b + i + 1, n - i - 1)) {
+				if (a[i] < b[i])
+					return true;
+				if (b[i] < a[i])
+					return false;
+			}
+			return n1 < n2;
+		}
+
+			// memcmp orders bytes as unsigned char
+		inline bool	lexicographical_compare(const unsigned char *a, size_t n1, const unsigned char *b, size_t n2) {
+			size_t	n = n1 < n2 ? n1 : n2;
+			int		res = n ? memcmp(a, b, n) : 0;
+
+			if (res != 0)
+				return res < 0;
+			return n1 < n2;
+		}
+
+		/* ------------------------------------------------------------- */
+		/**
+		*   Set bits in n 64-bit words, for ft::vector<bool>. Without
+		*   -mpopcnt the builtin is a table lookup, so the loop is also
+		*   compiled for POPCNT and picked at runtime.
+		*/
+		/* ------------------------------------------------------------- */
+
+		inline size_t	popcount_scalar(const uint64_t *w, size_t n) {
+			size_t	count = 0;
+
+			for (size_t i = 0; i < n; i++)
+				count += __builtin_popcountll(w[i]);
+			return count;
+		}
+
+# ifdef FT_SIMD_X86
+		__attribute__((target("popcnt")))
+		inline size_t	popcount_popcnt(const uint64_t *w, size_t n) {
+			size_t	count = 0;
+
+			for (size_t i = 0; i < n; i++)
+				count += __builtin_popcountll(w[i]);
+			return count;
+		}
+# endif
+
+		inline size_t	popcount(const uint64_t *w, size_t n) {
+# ifdef FT_SIMD_X86
+			static const bool	has_popcnt = (__builtin_cpu_init(), __builtin_cpu_supports("popcnt"));
+
+			if (has_popcnt)
+				return popcount_popcnt(w, n);
+# endif
+			return popcount_scalar(w, n);
+		}
+	}
+}
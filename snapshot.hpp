@@ -0,0 +1,496 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   snapshot.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 06:04:28 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/22 03:05:27 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#pragma once
+
+# include <algorithm>
+# include <cstring>
+# include <istream>
+# include <ostream>
+# include <stdexcept>
+# include <string>
+# include <stddef.h>
+# include <stdint.h>
+# include "vector.hpp"
+# include "map.hpp"
+
+namespace ft
+{
+	/**
+    * ------------------------------------------------------------- *
+    * ------------------------ FT::SNAPSHOT ----------------------- *
+    *
+    * Binary snapshots of ft::vector and ft::map, to reload a
+    * container without rebuilding it element by element.
+    *
+    * - Layout:
+    * header:               Magic, version, kind, byte order, element
+    *                       sizes and count, with its own checksum
+    * blocks:               Up to 256 KB of payload each, a length and
+    *                       a checksum, verified before any byte of the
+    *                       block is used
+    * end marker:           Empty block carrying the checksum of all the
+    *                       blocks, catching lost or reordered blocks
+    *
+    * - Payload:
+    * ft::vector:           data() written and read in bulk when T is
+    *                       trivially copyable, element by element else
+    *                       (and for the bit-packed ft::vector<bool>)
+    * ft::map:              Keys and values in key order, loaded through
+    *                       assign_sorted in linear time
+    *
+    * Elements go through snapshot_codec<T>: raw bytes for trivially
+    * copyable types, a length and the characters for std::string.
+    * Snapshots are in the byte order of the machine that wrote them,
+    * a reader on another byte order rejects them. Every failure
+    * throws ft::snapshot_error, a partially loaded container is left
+    * empty.
+    * ------------------------------------------------------------- *
+    */
+
+	class snapshot_error : public std::runtime_error
+	{
+		public:
+			explicit snapshot_error(const std::string& what) : std::runtime_error("ft::snapshot: " + what) { }
+	};
+
+		// Container recorded in the header
+	enum snapshot_kind { SNAPSHOT_VECTOR = 1, SNAPSHOT_MAP = 2 };
+
+	namespace snapshot_detail
+	{
+		static const char		magic[8] = { 'F', 'T', 'S', 'N', 'A', 'P', '\r', '\n' };
+		static const uint32_t	version = 1;
+		static const uint32_t	byte_order = 0x01020304;
+		static const size_t		block_size = 256 * 1024;
+
+		struct header {
+			char		magic[8];
+			uint32_t	version;
+			uint32_t	kind;
+			uint32_t	byte_order;
+			uint32_t	key_size;
+			uint32_t	value_size;
+			uint32_t	reserved;
+			uint64_t	count;
+			uint64_t	checksum;
+		};
+
+		/* ------------------------------------------------------------- */
+		/**
+		*   64 bit checksum, four independent multiply-xor lanes over
+		*   32 byte stripes so it runs at memory speed.
+		*/
+		/* ------------------------------------------------------------- */
+
+		inline uint64_t	mix(uint64_t h, uint64_t w) {
+			h = (h ^ w) * 0x9E3779B97F4A7C15ULL;
+			return h ^ (h >> 32);
+		}
+
+		inline uint64_t	checksum(const void *data, size_t n, uint64_t seed = 0) {
+			const unsigned char	*p = static_cast<const unsigned char *>(data);
+			uint64_t			h[4] = { seed, seed + 1, seed + 2, seed + 3 };
+			uint64_t			w;
+			size_t				i = 0;
+
+			for ( ; i + 32 <= n; i += 32)
+				for (size_t j = 0; j < 4; j++) {
+					memcpy(&w, p + i + 8 * j, 8);
+					h[j] = mix(h[j], w);
+				}
+			for ( ; i + 8 <= n; i += 8) {
+				memcpy(&w, p + i, 8);
+				h[0] = mix(h[0], w);
+			}
+			w = 0;
+			memcpy(&w, p + i, n - i);
+			h[0] = mix(h[0], w);
+			return mix(mix(mix(mix(n, h[0]), h[1]), h[2]), h[3]);
+		}
+	}
+
+	/* ------------------------------------------------------------- */
+	/**
+	*   Streaming writer: writes the header, buffers small writes into
+	*   blocks, sends big ones straight from the caller's memory.
+	*   finish() must be called once everything is written.
+	*/
+	/* ------------------------------------------------------------- */
+
+	class snapshot_writer
+	{
+		public:
+			snapshot_writer(std::ostream& os, uint32_t kind, uint32_t key_size, uint32_t value_size, uint64_t count)
+				: _os(os), _buf(snapshot_detail::block_size), _used(0), _total(0) {
+				snapshot_detail::header	h;
+
+				memset(&h, 0, sizeof(h));
+				memcpy(h.magic, snapshot_detail::magic, sizeof(h.magic));
+				h.version = snapshot_detail::version;
+				h.kind = kind;
+				h.byte_order = snapshot_detail::byte_order;
+				h.key_size = key_size;
+				h.value_size = value_size;
+				h.count = count;
+				h.checksum = snapshot_detail::checksum(&h, offsetof(snapshot_detail::header, checksum));
+				_put(&h, sizeof(h));
+			}
+
+			void	write(const void *data, size_t n) {
+				const char	*p = static_cast<const char *>(data);
+
+				while (n > 0) {
+					if (_used == 0 && n >= _buf.size()) {
+						_block(p, _buf.size());
+						p += _buf.size();
+						n -= _buf.size();
+						continue ;
+					}
+					size_t	len = std::min(n, _buf.size() - _used);
+
+					memcpy(_buf.data() + _used, p, len);
+					_used += len;
+					p += len;
+					n -= len;
+					if (_used == _buf.size())
+						flush();
+				}
+			}
+
+			void	flush() {
+				if (_used != 0)
+					_block(_buf.data(), _used);
+				_used = 0;
+			}
+
+			void	finish() {
+				uint64_t	end[2];
+
+				flush();
+				end[0] = 0;
+				end[1] = _total;
+				_put(end, sizeof(end));
+				_os.flush();
+				if (!_os)
+					throw snapshot_error("write failed");
+			}
+
+		private:
+			std::ostream&		_os;
+			ft::vector<char>	_buf;
+			size_t				_used;
+			uint64_t			_total;
+
+			snapshot_writer(const snapshot_writer&);
+			snapshot_writer&	operator=(const snapshot_writer&);
+
+			void	_put(const void *data, size_t n) {
+				if (!_os.write(static_cast<const char *>(data), n))
+					throw snapshot_error("write failed");
+			}
+
+			void	_block(const char *data, size_t n) {
+				uint64_t	len = n;
+				uint64_t	sum = snapshot_detail::checksum(data, n);
+
+				_put(&len, sizeof(len));
+				_put(data, n);
+				_put(&sum, sizeof(sum));
+				_total = snapshot_detail::mix(_total, sum);
+			}
+	};
+
+	/* ------------------------------------------------------------- */
+	/**
+	*   Streaming reader: checks the header against the expected kind
+	*   and element sizes, then hands out the payload block by block.
+	*   A read covering a whole block lands straight in the caller's
+	*   memory. finish() checks the end marker.
+	*/
+	/* ------------------------------------------------------------- */
+
+	class snapshot_reader
+	{
+		public:
+			snapshot_reader(std::istream& is, uint32_t kind, uint32_t key_size, uint32_t value_size)
+				: _is(is), _buf(snapshot_detail::block_size), _pos(0), _len(0), _total(0), _next(0) {
+				snapshot_detail::header	h;
+
+				_get(&h, sizeof(h));
+				if (memcmp(h.magic, snapshot_detail::magic, sizeof(h.magic)) != 0)
+					throw snapshot_error("not a snapshot");
+				if (h.checksum != snapshot_detail::checksum(&h, offsetof(snapshot_detail::header, checksum)))
+					throw snapshot_error("corrupted header");
+				if (h.version != snapshot_detail::version)
+					throw snapshot_error("unsupported version");
+				if (h.byte_order != snapshot_detail::byte_order)
+					throw snapshot_error("written with another byte order");
+				if (h.kind != kind || h.key_size != key_size || h.value_size != value_size)
+					throw snapshot_error("written for another container type");
+				_count = h.count;
+				_get(&_next, sizeof(_next));
+			}
+
+			uint64_t	count() const { return _count; }
+
+			void	read(void *data, size_t n) {
+				char	*p = static_cast<char *>(data);
+
+				while (n > 0) {
+					if (_pos == _len) {
+						if (_next == 0)
+							throw snapshot_error("truncated payload");
+						if (n >= _next) {
+							size_t	len = _next;
+
+							_block(p);
+							p += len;
+							n -= len;
+							continue ;
+						}
+						_block(_buf.data());
+					}
+					size_t	len = std::min(n, _len - _pos);
+
+					memcpy(p, _buf.data() + _pos, len);
+					_pos += len;
+					p += len;
+					n -= len;
+				}
+			}
+
+			void	finish() {
+				uint64_t	total;
+
+				if (_pos != _len || _next != 0)
+					throw snapshot_error("trailing payload");
+				_get(&total, sizeof(total));
+				if (total != _total)
+					throw snapshot_error("missing or reordered blocks");
+			}
+
+		private:
+			std::istream&		_is;
+			ft::vector<char>	_buf;
+			size_t				_pos;
+			size_t				_len;
+			uint64_t			_count;
+			uint64_t			_total;
+			uint64_t			_next;
+
+			snapshot_reader(const snapshot_reader&);
+			snapshot_reader&	operator=(const snapshot_reader&);
+
+			void	_get(void *data, size_t n) {
+				if (!_is.read(static_cast<char *>(data), n))
+					throw snapshot_error("truncated snapshot");
+			}
+
+				// Reads the block of length _next into dst, checks it and
+				// the length of the following one
+			void	_block(char *dst) {
+				uint64_t	sum;
+
+				if (_next > _buf.size())
+					throw snapshot_error("corrupted block length");
+				_get(dst, _next);
+				_get(&sum, sizeof(sum));
+				if (sum != snapshot_detail::checksum(dst, _next))
+					throw snapshot_error("corrupted block");
+				_total = snapshot_detail::mix(_total, sum);
+				_pos = 0;
+				_len = (dst == _buf.data()) ? _next : 0;
+				_get(&_next, sizeof(_next));
+			}
+	};
+
+	/* ------------------------------------------------------------- */
+	/**
+	*   Element encoding. size() is recorded in the header, 0 for
+	*   variable length types. Specialize for other types.
+	*/
+	/* ------------------------------------------------------------- */
+
+	template <class T>
+	struct snapshot_codec {
+		static_assert(ft::is_trivially_copyable<T>::value, "ft::snapshot_codec: T needs a specialization");
+
+		static uint32_t	size() { return sizeof(T); }
+		static void		put(snapshot_writer& w, const T& x) { w.write(&x, sizeof(T)); }
+		static void		get(snapshot_reader& r, T& x) { r.read(&x, sizeof(T)); }
+	};
+
+	template <class C, class Traits, class Alloc>
+	struct snapshot_codec<std::basic_string<C, Traits, Alloc> > {
+		typedef std::basic_string<C, Traits, Alloc>	string_type;
+
+		static uint32_t	size() { return 0; }
+		static void		put(snapshot_writer& w, const string_type& x) {
+			uint64_t	len = x.size();
+
+			w.write(&len, sizeof(len));
+			w.write(x.data(), len * sizeof(C));
+		}
+		static void		get(snapshot_reader& r, string_type& x) {
+			uint64_t	len;
+
+			r.read(&len, sizeof(len));
+			x.resize(len);
+			if (len != 0)
+				r.read(&x[0], len * sizeof(C));
+		}
+	};
+
+	/* ------------------------------------------------------------- */
+	/**
+	*   Input iterator over the entries of a map snapshot, so a map
+	*   streams in without holding the whole payload. Reaching the
+	*   end checks the end marker.
+	*/
+	/* ------------------------------------------------------------- */
+
+	template <class Key, class T>
+	class snapshot_iterator
+	{
+		public:
+			typedef std::input_iterator_tag		iterator_category;
+			typedef ft::pair<Key, T>			value_type;
+			typedef std::ptrdiff_t				difference_type;
+			typedef const value_type*			pointer;
+			typedef const value_type&			reference;
+
+			snapshot_iterator() : _reader(nullptr), _left(0) { }
+			explicit snapshot_iterator(snapshot_reader& r) : _reader(&r), _left(r.count()) { _next(); }
+
+			reference			operator*() const { return _value; }
+			pointer				operator->() const { return &_value; }
+			snapshot_iterator&	operator++() { _next(); return *this; }
+			snapshot_iterator	operator++(int) {
+				snapshot_iterator	tmp(*this);
+
+				_next();
+				return tmp;
+			}
+			bool	operator==(const snapshot_iterator& x) const { return _reader == x._reader; }
+			bool	operator!=(const snapshot_iterator& x) const { return _reader != x._reader; }
+
+		private:
+			snapshot_reader*	_reader;
+			uint64_t			_left;
+			value_type			_value;
+
+			void	_next() {
+				if (_left == 0) {
+					_reader->finish();
+					_reader = nullptr;
+					return ;
+				}
+				snapshot_codec<Key>::get(*_reader, _value.first);
+				snapshot_codec<T>::get(*_reader, _value.second);
+				_left--;
+			}
+	};
+
+	namespace snapshot_detail
+	{
+			// Whether data() can be written as is; vector<bool> packs its
+			// bits and has no data(), it goes element by element
+		template <class T>
+		struct bulk : public ft::integral_constant<bool, ft::is_trivially_copyable<T>::value> { };
+		template <>
+		struct bulk<bool> : public ft::false_type { };
+
+		template <class T, class Alloc>
+		void	save(snapshot_writer& w, const ft::vector<T, Alloc>& v, ft::true_type) {
+			w.write(v.data(), v.size() * sizeof(T));
+		}
+
+		template <class T, class Alloc>
+		void	save(snapshot_writer& w, const ft::vector<T, Alloc>& v, ft::false_type) {
+			for (typename ft::vector<T, Alloc>::size_type i = 0; i < v.size(); i++)
+				snapshot_codec<T>::put(w, v[i]);
+		}
+
+		template <class T, class Alloc>
+		void	load(snapshot_reader& r, ft::vector<T, Alloc>& v, ft::true_type) {
+			v.resize(r.count());
+			r.read(v.data(), v.size() * sizeof(T));
+		}
+
+		template <class T, class Alloc>
+		void	load(snapshot_reader& r, ft::vector<T, Alloc>& v, ft::false_type) {
+			T	x;
+
+			v.reserve(r.count());
+			for (uint64_t i = 0; i < r.count(); i++) {
+				snapshot_codec<T>::get(r, x);
+				v.push_back(x);
+			}
+		}
+	}
+
+	/* ------------------------------------------------------------- */
+	/**
+	*   Save and load, for streams opened in binary mode.
+	*/
+	/* ------------------------------------------------------------- */
+
+	template <class T, class Alloc>
+	void	save_snapshot(std::ostream& os, const ft::vector<T, Alloc>& v) {
+		snapshot_writer	w(os, SNAPSHOT_VECTOR, snapshot_codec<T>::size(), 0, v.size());
+
+		snapshot_detail::save(w, v, typename snapshot_detail::bulk<T>::type());
+		w.finish();
+	}
+
+	template <class T, class Alloc>
+	void	load_snapshot(std::istream& is, ft::vector<T, Alloc>& v) {
+		snapshot_reader	r(is, SNAPSHOT_VECTOR, snapshot_codec<T>::size(), 0);
+
+		v.clear();
+		try {
+			snapshot_detail::load(r, v, typename snapshot_detail::bulk<T>::type());
+			r.finish();
+		}
+		catch (...) {
+			v.clear();
+			throw;
+		}
+	}
+
+	template <class Key, class T, class Compare, class Alloc, bool Threaded>
+	void	save_snapshot(std::ostream& os, const ft::map<Key, T, Compare, Alloc, Threaded>& m) {
+		snapshot_writer	w(os, SNAPSHOT_MAP, snapshot_codec<Key>::size(), snapshot_codec<T>::size(), m.size());
+
+		for (typename ft::map<Key, T, Compare, Alloc, Threaded>::const_iterator it = m.begin(); it != m.end(); ++it) {
+			snapshot_codec<Key>::put(w, it->first);
+			snapshot_codec<T>::put(w, it->second);
+		}
+		w.finish();
+	}
+
+	template <class Key, class T, class Compare, class Alloc, bool Threaded>
+	void	load_snapshot(std::istream& is, ft::map<Key, T, Compare, Alloc, Threaded>& m) {
+		snapshot_reader	r(is, SNAPSHOT_MAP, snapshot_codec<Key>::size(), snapshot_codec<T>::size());
+
+		// The iterator reads the first entry, or the end marker, as soon
+		// as it is made: the old entries go first
+		m.clear();
+		try {
+			m.assign_sorted(snapshot_iterator<Key, T>(r), snapshot_iterator<Key, T>());
+		}
+		catch (...) {
+			m.clear();
+			throw;
+		}
+	}
+}
@@ -0,0 +1,408 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   soa_vector.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 00:20:23 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/21 22:52:30 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+# include <memory>
+# include <cstring>
+# include <limits>
+# include <stdexcept>
+# include <stddef.h>
+# include "span.hpp"
+# include "algorithm.hpp"
+# include "type_traits.hpp"
+
+namespace ft
+{
+	/**
+    * ------------------------------------------------------------- *
+    * ---------------------- FT::SOA_VECTOR ----------------------- *
+    *
+    * A vector of rows of Fields... stored as one array per field
+    * (structure of arrays): a scan of one field reads only that
+    * field's bytes, and column(I) hands the array out as an ft::span
+    * whose loops vectorize. All columns share one size and one
+    * capacity, doubled on push_back like ft::vector.
+    *
+    * - Coplien form:
+    * (constructor):        Empty, or n value-initialized rows
+    * (destructor), operator=
+    *
+    * - Capacity:
+    * size, capacity, empty, max_size
+    * reserve:              Reallocate every column at once
+    * shrink_to_fit:        Capacity down to the size
+    *
+    * - Element access:
+    * operator[], at:       Row proxy, get<I>() is the I-th field
+    * front, back:          First and last rows
+    * column<I>:            Span over the I-th field of every row
+    * data<I>:              Pointer to the I-th column
+    *
+    * - Modifiers:
+    * push_back:            Append a row given field by field
+    * pop_back, resize, clear, swap
+    *
+    * Row proxies stand for a row of the container: assigning one
+    * copies the fields into that row, get<I>() returns a reference
+    * into the column. Like pointers and spans into the columns, they
+    * are invalidated by anything that reallocates. Reallocation is
+    * all or nothing: if a copy throws, the old columns stay.
+    * ------------------------------------------------------------- *
+    */
+
+	namespace soa_detail
+	{
+			// Type of the I-th field
+		template <size_t I, class T, class... Rest>
+		struct field { typedef typename field<I - 1, Rest...>::type type; };
+		template <class T, class... Rest>
+		struct field<0, T, Rest...> { typedef T type; };
+
+			// Bytes of one row, summed over the fields
+		template <class... Fields>
+		struct row_size { static const size_t value = 0; };
+		template <class T, class... Rest>
+		struct row_size<T, Rest...> { static const size_t value = sizeof(T) + row_size<Rest...>::value; };
+
+			// One array per field, the first one here and the others in the
+			// bases; each operation handles its array, then the bases'.
+		template <class... Fields>
+		struct columns
+		{
+			void	assign_from(const columns&, size_t, size_t, size_t, size_t) { }
+			void	release(size_t, size_t) { }
+			void	destroy_from(size_t, size_t) { }
+			void	construct(size_t) { }
+			void	construct_default(size_t, size_t) { }
+			void	assign_row(size_t, const columns&, size_t) { }
+			void	assign_values(size_t) { }
+			void	swap(columns&) { }
+		};
+
+		template <class T, class... Rest>
+		struct columns<T, Rest...> : columns<Rest...>
+		{
+			typedef columns<Rest...>	rest;
+
+			std::allocator<T>	alloc;
+			T*					data;
+
+			columns() : data(NULL) { }
+
+				// Replaces the arrays (size elements, cap slots) by arrays of
+				// cap_to slots holding the n first rows of src. On a throw the
+				// arrays built so far are freed and the old ones stay.
+			void	assign_from(const columns& src, size_t n, size_t cap_to, size_t size, size_t cap) {
+				T*	fresh = alloc.allocate(cap_to);
+
+				try {
+					copy(src.data, n, fresh);
+				}
+				catch (...) {
+					alloc.deallocate(fresh, cap_to);
+					throw;
+				}
+				try {
+					rest::assign_from(src, n, cap_to, size, cap);
+				}
+				catch (...) {
+					destroy(fresh, n);
+					alloc.deallocate(fresh, cap_to);
+					throw;
+				}
+				destroy(data, size);
+				if (data != NULL)
+					alloc.deallocate(data, cap);
+				data = fresh;
+			}
+			void	release(size_t size, size_t cap) {
+				destroy(data, size);
+				if (data != NULL)
+					alloc.deallocate(data, cap);
+				data = NULL;
+				rest::release(size, cap);
+			}
+				// Destroys the rows from new_size to size
+			void	destroy_from(size_t new_size, size_t size) {
+				destroy(data + new_size, size - new_size);
+				rest::destroy_from(new_size, size);
+			}
+				// Constructs row i from one value per field, all or none
+			void	construct(size_t i, const T& value, const Rest&... values) {
+				alloc.construct(data + i, value);
+				try {
+					rest::construct(i, values...);
+				}
+				catch (...) {
+					alloc.destroy(data + i);
+					throw;
+				}
+			}
+			void	construct_default(size_t from, size_t to) {
+				size_t	i = from;
+
+				try {
+					for ( ; i < to; i++)
+						alloc.construct(data + i, T());
+					rest::construct_default(from, to);
+				}
+				catch (...) {
+					destroy(data + from, i - from);
+					throw;
+				}
+			}
+			void	assign_row(size_t i, const columns& src, size_t j) {
+				data[i] = src.data[j];
+				rest::assign_row(i, src, j);
+			}
+			void	assign_values(size_t i, const T& value, const Rest&... values) {
+				data[i] = value;
+				rest::assign_values(i, values...);
+			}
+			void	swap(columns& x) {
+				ft::swap(data, x.data);
+				rest::swap(x);
+			}
+
+			void	copy(const T* from, size_t n, T* to) {
+				size_t	i = 0;
+
+				if (ft::is_trivially_copyable<T>::value) {
+					if (n != 0)
+						std::memcpy(static_cast<void*>(to), static_cast<const void*>(from), n * sizeof(T));
+					return ;
+				}
+				try {
+					for ( ; i < n; i++)
+						alloc.construct(to + i, from[i]);
+				}
+				catch (...) {
+					destroy(to, i);
+					throw;
+				}
+			}
+			void	destroy(T* p, size_t n) {
+				if (!ft::is_trivially_destructible<T>::value)
+					for (size_t i = 0; i < n; i++)
+						alloc.destroy(p + i);
+			}
+		};
+
+			// The columns object of the I-th field and those after it
+		template <size_t I, class T, class... Rest>
+		struct column_at { typedef typename column_at<I - 1, Rest...>::type type; };
+		template <class T, class... Rest>
+		struct column_at<0, T, Rest...> { typedef columns<T, Rest...> type; };
+	}
+
+	template <class... Fields>
+	class soa_vector
+	{
+		static_assert(sizeof...(Fields) > 0, "ft::soa_vector: needs at least one field");
+
+		typedef soa_detail::columns<Fields...>	columns;
+
+		public:
+			/* ------------------------------------------------------------- */
+			/* -------------------------- ALIASES -------------------------- */
+			typedef	size_t			size_type;
+			typedef	ptrdiff_t		difference_type;
+
+			static const size_type	field_count = sizeof...(Fields);
+
+			template <size_t I>
+			struct field { typedef typename soa_detail::field<I, Fields...>::type type; };
+
+			class const_reference;
+
+				// Row proxy
+			class reference
+			{
+				friend class soa_vector;
+
+				public:
+					reference(const reference& x) : _v(x._v), _i(x._i) { }
+
+					template <size_t I>
+					typename field<I>::type&	get() const { return _v->template data<I>()[_i]; }
+						// Copies the fields of x into this row
+					reference&	operator=(const reference& x) {
+						_v->_columns.assign_row(_i, x._v->_columns, x._i);
+						return *this;
+					}
+					reference&	operator=(const const_reference& x) {
+						_v->_columns.assign_row(_i, x._v->_columns, x._i);
+						return *this;
+					}
+					void		assign(const Fields&... values) const { _v->_columns.assign_values(_i, values...); }
+					size_type	index() const { return _i; }
+
+				private:
+					soa_vector*	_v;
+					size_type	_i;
+
+					reference(soa_vector* v, size_type i) : _v(v), _i(i) { }
+			};
+
+			class const_reference
+			{
+				friend class soa_vector;
+				friend class reference;
+
+				public:
+					const_reference(const const_reference& x) : _v(x._v), _i(x._i) { }
+					const_reference(const reference& x) : _v(x._v), _i(x._i) { }
+
+					template <size_t I>
+					const typename field<I>::type&	get() const { return _v->template data<I>()[_i]; }
+					size_type	index() const { return _i; }
+
+				private:
+					const soa_vector*	_v;
+					size_type			_i;
+
+					const_reference(const soa_vector* v, size_type i) : _v(v), _i(i) { }
+					const_reference&	operator=(const const_reference&);
+			};
+
+			/* ------------------------------------------------------------- */
+			/* ------------------------ COPLIEN FORM ----------------------- */
+
+			soa_vector() : _size(0), _cap(0) { }
+			explicit soa_vector(size_type n) : _size(0), _cap(0) { resize(n); }
+			soa_vector(const soa_vector& x) : _size(0), _cap(0) {
+				_columns.assign_from(x._columns, x._size, x._size, 0, 0);
+				_size = x._size;
+				_cap = x._size;
+			}
+			~soa_vector() { _columns.release(_size, _cap); }
+			soa_vector&	operator=(const soa_vector& x) {
+				if (this != &x) {
+					_columns.assign_from(x._columns, x._size, x._size, _size, _cap);
+					_size = x._size;
+					_cap = x._size;
+				}
+				return *this;
+			}
+
+			/* ------------------------------------------------------------- */
+			/* -------------------------- CAPACITY ------------------------- */
+
+			size_type	size() const { return _size; }
+			size_type	capacity() const { return _cap; }
+			bool		empty() const { return _size == 0; }
+			size_type	max_size() const {
+				return std::numeric_limits<size_type>::max() / 2 / soa_detail::row_size<Fields...>::value;
+			}
+			void		reserve(size_type n) {
+				if (n > max_size())
+					throw std::length_error("ft::soa_vector");
+				if (n > _cap)
+					_reallocate(n);
+			}
+			void		shrink_to_fit() {
+				if (_size < _cap)
+					_reallocate(_size);
+			}
+
+			/* ------------------------------------------------------------- */
+			/* ----------------------- ELEMENT ACCESS ---------------------- */
+
+			reference		operator[](size_type i) { return reference(this, i); }
+			const_reference	operator[](size_type i) const { return const_reference(this, i); }
+			reference		at(size_type i) {
+				if (i >= _size)
+					throw std::out_of_range("ft::soa_vector");
+				return reference(this, i);
+			}
+			const_reference	at(size_type i) const {
+				if (i >= _size)
+					throw std::out_of_range("ft::soa_vector");
+				return const_reference(this, i);
+			}
+			reference		front() { return reference(this, 0); }
+			const_reference	front() const { return const_reference(this, 0); }
+			reference		back() { return reference(this, _size - 1); }
+			const_reference	back() const { return const_reference(this, _size - 1); }
+
+			template <size_t I>
+			typename field<I>::type*		data() { return _column<I>().data; }
+			template <size_t I>
+			const typename field<I>::type*	data() const { return _column<I>().data; }
+			template <size_t I>
+			ft::span<typename field<I>::type>		column() {
+				return ft::span<typename field<I>::type>(data<I>(), _size);
+			}
+			template <size_t I>
+			ft::span<const typename field<I>::type>	column() const {
+				return ft::span<const typename field<I>::type>(data<I>(), _size);
+			}
+
+			/* ------------------------------------------------------------- */
+			/* ------------------------- MODIFIERS ------------------------- */
+
+			void	push_back(const Fields&... values) {
+				if (_size == _cap)
+					reserve(_cap ? _cap * 2 : 1);
+				_columns.construct(_size, values...);
+				_size++;
+			}
+			void	pop_back() {
+				if (_size != 0) {
+					_columns.destroy_from(_size - 1, _size);
+					_size--;
+				}
+			}
+				// New rows are value-initialized, field by field
+			void	resize(size_type n) {
+				if (n < _size) {
+					_columns.destroy_from(n, _size);
+					_size = n;
+					return ;
+				}
+				reserve(n);
+				_columns.construct_default(_size, n);
+				_size = n;
+			}
+			void	clear() {
+				_columns.destroy_from(0, _size);
+				_size = 0;
+			}
+			void	swap(soa_vector& x) {
+				_columns.swap(x._columns);
+				ft::swap(_size, x._size);
+				ft::swap(_cap, x._cap);
+			}
+
+		private:
+			columns		_columns;
+			size_type	_size;
+			size_type	_cap;
+
+			template <size_t I>
+			typename soa_detail::column_at<I, Fields...>::type&	_column() {
+				return static_cast<typename soa_detail::column_at<I, Fields...>::type&>(_columns);
+			}
+			template <size_t I>
+			const typename soa_detail::column_at<I, Fields...>::type&	_column() const {
+				return static_cast<const typename soa_detail::column_at<I, Fields...>::type&>(_columns);
+			}
+			void	_reallocate(size_type cap) {
+				_columns.assign_from(_columns, _size, cap, _size, _cap);
+				_cap = cap;
+			}
+	};
+
+	template <class... Fields>
+	void	swap(soa_vector<Fields...>& x, soa_vector<Fields...>& y) { x.swap(y); }
+}
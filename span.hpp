@@ -0,0 +1,83 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   span.hpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 00:14:53 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/21 01:15:44 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+# include <stddef.h>
+# include <stdexcept>
+
+namespace ft
+{
+	/**
+    * ------------------------------------------------------------- *
+    * ------------------------- FT::SPAN -------------------------- *
+    *
+    * A view of n contiguous T owned by someone else (a column of
+    * ft::soa_vector, a vector's data()). Iterators are plain
+    * pointers, so loops over a span compile like loops over an
+    * array and vectorize. Valid until the owner reallocates.
+    *
+    * - Element access:
+    * operator[], at, front, back, data
+    *
+    * - Iterators:
+    * begin, end
+    *
+    * - Capacity:
+    * size, empty
+    *
+    * - Views:
+    * subspan:              The n elements from an offset
+    * ------------------------------------------------------------- *
+    */
+
+	template <class T>
+	class span
+	{
+		public:
+			typedef	T			value_type;
+			typedef	size_t		size_type;
+			typedef	ptrdiff_t	difference_type;
+			typedef	T&			reference;
+			typedef	T*			pointer;
+			typedef	T*			iterator;
+
+			span() : _data(NULL), _size(0) { }
+			span(T* data, size_type size) : _data(data), _size(size) { }
+				// A span of T converts to a span of const T
+			template <class U>
+			span(const span<U>& x) : _data(x.data()), _size(x.size()) { }
+
+			T*			data() const { return _data; }
+			size_type	size() const { return _size; }
+			bool		empty() const { return _size == 0; }
+			iterator	begin() const { return _data; }
+			iterator	end() const { return _data + _size; }
+			reference	operator[](size_type i) const { return _data[i]; }
+			reference	front() const { return _data[0]; }
+			reference	back() const { return _data[_size - 1]; }
+			reference	at(size_type i) const {
+				if (i >= _size)
+					throw std::out_of_range("ft::span");
+				return _data[i];
+			}
+			span		subspan(size_type offset, size_type n) const {
+				if (offset > _size)
+					throw std::out_of_range("ft::span");
+				return span(_data + offset, n < _size - offset ? n : _size - offset);
+			}
+
+		private:
+			T*			_data;
+			size_type	_size;
+	};
+}
@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stack.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 21:35:04 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/19 21:35:04 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+# include "vector.hpp"
+
+namespace ft
+{
+	/**
+    * ------------------------------------------------------------- *
+    * ------------------------ FT::STACK -------------------------- *
+    *
+    * LIFO adaptor, the top of the stack is the back of the container.
+    *
+    * - Member functions:
+    * (constructor):        Construct stack
+    * empty:                Test whether container is empty
+    * size:                 Return size
+    * top:                  Access next element
+    * push:                 Insert element
+    * pop:                  Remove top element
+    * swap:                 Swap contents
+    *
+    * - Non-member function overloads:
+    * relational operators: Relational operators for stack
+    * swap:                 Exchange contents of two stacks
+    * ------------------------------------------------------------- *
+    */
+	template <class T, class Container = ft::vector<T> >
+	class stack
+	{
+		public:
+			typedef	T									value_type;
+			typedef	Container							container_type;
+			typedef	typename Container::size_type		size_type;
+			typedef	typename Container::reference		reference;
+			typedef	typename Container::const_reference	const_reference;
+
+		protected:
+			container_type	c;
+
+		public:
+			explicit stack ( const container_type& ctnr = container_type() ) : c(ctnr) { }
+
+			bool			empty() const					{ return c.empty(); }
+			size_type		size() const					{ return c.size(); }
+			reference		top()							{ return c.back(); }
+			const_reference	top() const						{ return c.back(); }
+			void			push(const value_type& val)		{ c.push_back(val); }
+			void			pop()							{ c.pop_back(); }
+			void			swap(stack& x)					{ ft::swap(c, x.c); }
+
+			friend bool	operator==(const stack& lhs, const stack& rhs)	{ return lhs.c == rhs.c; }
+			friend bool	operator!=(const stack& lhs, const stack& rhs)	{ return lhs.c != rhs.c; }
+			friend bool	operator<(const stack& lhs, const stack& rhs)	{ return lhs.c < rhs.c; }
+			friend bool	operator<=(const stack& lhs, const stack& rhs)	{ return lhs.c <= rhs.c; }
+			friend bool	operator>(const stack& lhs, const stack& rhs)	{ return lhs.c > rhs.c; }
+			friend bool	operator>=(const stack& lhs, const stack& rhs)	{ return lhs.c >= rhs.c; }
+	};
+
+	template <class T, class Container>
+	void	swap(stack<T,Container>& x, stack<T,Container>& y) {
+		x.swap(y);
+	}
+}
@@ -0,0 +1,285 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   thread_pool.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:30:57 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/19 13:30:57 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+# include <pthread.h>
+# include <sched.h>
+# include <unistd.h>
+# include <stdexcept>
+# include "vector.hpp"
+
+namespace ft
+{
+	/**
+    * ------------------------------------------------------------- *
+    * ----------------------- FT::THREAD_POOL --------------------- *
+    *
+    * Fixed set of threads running one data-parallel loop at a time.
+    * parallel_for cuts [0, n) into chunks and gives every thread a
+    * contiguous run of them. A thread takes chunks from the front of
+    * its own run; once it is empty it steals from the back of the
+    * others, so uneven chunks balance out. The calling thread works
+    * too: a pool of size() threads starts size() - 1 workers.
+    *
+    * A run is a [head, tail) pair packed in one 64 bit word, so
+    * taking and stealing are a single compare-and-swap.
+    * If the pool is already busy (nested or concurrent call) the
+    * loop runs inline on the caller. Chunk functions must not throw.
+    * ------------------------------------------------------------- *
+    */
+
+	class thread_pool
+	{
+		public:
+			typedef void	(*chunk_function)(void *ctx, size_t begin, size_t end);
+
+			// Automatic grain: about 8 chunks per thread, never below min_grain
+			static const size_t	chunks_per_thread = 8;
+			static const size_t	min_grain = 2048;
+
+		private:
+			typedef unsigned long long	run_type;
+
+			struct worker_run
+			{
+				run_type	run;
+				char		pad[64 - sizeof(run_type)];
+			};
+
+			struct worker_arg
+			{
+				thread_pool	*pool;
+				size_t		index;
+			};
+
+			size_t					_nthreads;
+			ft::vector<pthread_t>	_threads;
+			ft::vector<worker_arg>	_args;
+			worker_run				*_runs;
+			pthread_mutex_t			_submit;
+			pthread_mutex_t			_lock;
+			pthread_cond_t			_wake;
+			size_t					_generation;
+			bool					_stop;
+			chunk_function			_fn;
+			void					*_ctx;
+			size_t					_n;
+			size_t					_grain;
+			size_t					_pending;
+
+			thread_pool(const thread_pool&);
+			thread_pool&	operator=(const thread_pool&);
+
+		public:
+			/* ------------------------------------------------------------- */
+            /**
+            *   Starts the workers.
+            *
+            *   @param threads  Number of threads including the caller, 0 for
+            *                   one per online CPU.
+            */
+            /* ------------------------------------------------------------- */
+
+			explicit thread_pool(size_t threads = 0) : _nthreads(threads), _generation(0), _stop(false),
+						_fn(nullptr), _ctx(nullptr), _n(0), _grain(1), _pending(0) {
+				if (_nthreads == 0)
+					_nthreads = hardware_concurrency();
+				_runs = new worker_run[_nthreads];
+				for (size_t i = 0; i < _nthreads; i++)
+					_runs[i].run = 0;
+				pthread_mutex_init(&_submit, NULL);
+				pthread_mutex_init(&_lock, NULL);
+				pthread_cond_init(&_wake, NULL);
+				_args.resize(_nthreads);
+				_threads.resize(_nthreads);
+				for (size_t i = 1; i < _nthreads; i++) {
+					_args[i].pool = this;
+					_args[i].index = i;
+					if (pthread_create(&_threads[i], NULL, _entry, &_args[i]) != 0) {
+						_nthreads = i;
+						_shutdown();
+						throw std::runtime_error("ft::thread_pool");
+					}
+				}
+			}
+
+			~thread_pool() { _shutdown(); }
+
+			/* ------------------------------------------------------------- */
+
+			size_t	size() const { return _nthreads; }
+
+			/* ------------------------------------------------------------- */
+
+			static size_t	hardware_concurrency() {
+				long	n = sysconf(_SC_NPROCESSORS_ONLN);
+
+				return n > 0 ? static_cast<size_t>(n) : 1;
+			}
+
+			/* ------------------------------------------------------------- */
+            /**
+            *   Pool shared by the parallel algorithms when none is given.
+            */
+            /* ------------------------------------------------------------- */
+
+			static thread_pool&	instance() {
+				static thread_pool	pool;
+
+				return pool;
+			}
+
+			/* ------------------------------------------------------------- */
+            /**
+            *   Grain used for n elements: picked from the pool size when the
+            *   caller passes 0, raised if the chunks would not fit in a run.
+            */
+            /* ------------------------------------------------------------- */
+
+			size_t	grain_for(size_t n, size_t grain = 0) const {
+				if (grain == 0) {
+					grain = n / (_nthreads * chunks_per_thread);
+					if (grain < min_grain)
+						grain = min_grain;
+				}
+				if (chunk_count(n, grain) > 0xffffffffULL)
+					grain = n / 0xffffffffULL + 1;
+				return grain;
+			}
+
+			/* ------------------------------------------------------------- */
+
+			size_t	chunk_count(size_t n, size_t grain) const {
+				return (n + grain - 1) / grain;
+			}
+
+			/* ------------------------------------------------------------- */
+            /**
+            *   Calls fn(ctx, begin, end) over chunks covering [0, n) and returns
+            *   once all of them are done. Chunk c is [c * grain, (c + 1) * grain).
+            *
+            *   @param grain    Chunk length, 0 to pick one from the pool size.
+            */
+            /* ------------------------------------------------------------- */
+
+			void	parallel_for(size_t n, size_t grain, chunk_function fn, void *ctx) {
+				if (n == 0)
+					return;
+				grain = grain_for(n, grain);
+				size_t	chunks = chunk_count(n, grain);
+				if (_nthreads == 1 || chunks == 1 || pthread_mutex_trylock(&_submit) != 0) {
+					for (size_t c = 0; c < chunks; c++)
+						fn(ctx, c * grain, c + 1 == chunks ? n : (c + 1) * grain);
+					return;
+				}
+				_fn = fn; _ctx = ctx; _n = n; _grain = grain;
+				__atomic_store_n(&_pending, chunks, __ATOMIC_RELAXED);
+				for (size_t i = 0; i < _nthreads; i++)
+					__atomic_store_n(&_runs[i].run, _pack(chunks * i / _nthreads, chunks * (i + 1) / _nthreads),
+									__ATOMIC_RELEASE);
+				pthread_mutex_lock(&_lock);
+				_generation++;
+				pthread_cond_broadcast(&_wake);
+				pthread_mutex_unlock(&_lock);
+				_work(0);
+				while (__atomic_load_n(&_pending, __ATOMIC_ACQUIRE) != 0)
+					sched_yield();
+				pthread_mutex_unlock(&_submit);
+			}
+
+            /* ------------------------------------------------------------- */
+            /**
+            *      PRIVATE Utils functions
+            */
+            /* ------------------------------------------------------------- */
+		private:
+			static run_type	_pack(size_t head, size_t tail) {
+				return (static_cast<run_type>(tail) << 32) | static_cast<run_type>(head);
+			}
+			static size_t	_head(run_type run) { return static_cast<size_t>(run & 0xffffffffULL); }
+			static size_t	_tail(run_type run) { return static_cast<size_t>(run >> 32); }
+
+			/* ------------------------------------------------------------- */
+
+			// Takes the first chunk of a run (owner) or the last one (thief)
+			bool	_take(size_t index, bool steal, size_t& chunk) {
+				run_type	run = __atomic_load_n(&_runs[index].run, __ATOMIC_ACQUIRE);
+
+				while (_head(run) < _tail(run)) {
+					size_t		head = _head(run);
+					size_t		tail = _tail(run);
+					run_type	next = steal ? _pack(head, tail - 1) : _pack(head + 1, tail);
+
+					if (__atomic_compare_exchange_n(&_runs[index].run, &run, next, false,
+													__ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+						chunk = steal ? tail - 1 : head;
+						return true;
+					}
+				}
+				return false;
+			}
+
+			/* ------------------------------------------------------------- */
+
+			void	_work(size_t self) {
+				size_t	chunk;
+
+				for (;;) {
+					bool	found = _take(self, false, chunk);
+					for (size_t i = 1; !found && i < _nthreads; i++)
+						found = _take((self + i) % _nthreads, true, chunk);
+					if (!found)
+						return;
+					size_t	begin = chunk * _grain;
+					size_t	end = begin + _grain < _n ? begin + _grain : _n;
+					_fn(_ctx, begin, end);
+					__atomic_sub_fetch(&_pending, 1, __ATOMIC_RELEASE);
+				}
+			}
+
+			/* ------------------------------------------------------------- */
+
+			static void	*_entry(void *arg) {
+				worker_arg	*self = static_cast<worker_arg *>(arg);
+				thread_pool	*pool = self->pool;
+				size_t		seen = 0;
+
+				for (;;) {
+					pthread_mutex_lock(&pool->_lock);
+					while (!pool->_stop && pool->_generation == seen)
+						pthread_cond_wait(&pool->_wake, &pool->_lock);
+					seen = pool->_generation;
+					bool	stop = pool->_stop;
+					pthread_mutex_unlock(&pool->_lock);
+					if (stop)
+						return NULL;
+					pool->_work(self->index);
+				}
+			}
+
+			/* ------------------------------------------------------------- */
+
+			void	_shutdown() {
+				pthread_mutex_lock(&_lock);
+				_stop = true;
+				pthread_cond_broadcast(&_wake);
+				pthread_mutex_unlock(&_lock);
+				for (size_t i = 1; i < _nthreads; i++)
+					pthread_join(_threads[i], NULL);
+				pthread_cond_destroy(&_wake);
+				pthread_mutex_destroy(&_lock);
+				pthread_mutex_destroy(&_submit);
+				delete[] _runs;
+			}
+	};
+}
@@ -6,7 +6,7 @@
 /*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/12/08 17:27:48 by moabid            #+#    #+#             */
-/*   Updated: 2022/12/08 23:50:58 by moabid           ###   ########.fr       */
+/*   Updated: 2026/10/21 22:07:15 by moabid           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -168,4 +168,70 @@ namespace ft
 	struct is_integral<unsigned volatile long long int> : public true_type { };
 	template <>
 	struct is_integral<const volatile unsigned long long int> : public true_type { };
+
+	/* ------------------------------------------------------------- */
+    /**
+    *   Is_same checks whether two types are the same type
+    */
+    /* ------------------------------------------------------------- */
+
+	template <class T, class U>
+	struct is_same : public false_type { };
+
+	template <class T>
+	struct is_same<T, T> : public true_type { };
+
+	/* ------------------------------------------------------------- */
+    /**
+    *   Is_floating_point checks whether T is float, double or long double
+    */
+    /* ------------------------------------------------------------- */
+
+	template <class T>
+	struct is_floating_point : public false_type { };
+
+	template <>
+	struct is_floating_point<float> : public true_type { };
+	template <>
+	struct is_floating_point<double> : public true_type { };
+	template <>
+	struct is_floating_point<long double> : public true_type { };
+
+	/* ------------------------------------------------------------- */
+    /**
+    *   Remove_const gives T without its top-level const qualifier
+    */
+    /* ------------------------------------------------------------- */
+
+	template <class T>
+	struct remove_const {
+		typedef T	type;
+	};
+
+	template <class T>
+	struct remove_const<const T> {
+		typedef T	type;
+	};
+
+	/* ------------------------------------------------------------- */
+    /**
+    *   Is_trivially_copyable and is_trivially_destructible, from the
+    *   compiler builtins so <type_traits> is not needed
+    */
+    /* ------------------------------------------------------------- */
+
+	template <class T>
+	struct is_trivially_copyable : public integral_constant<bool, __is_trivially_copyable(T)> { };
+
+	template <class T>
+	struct is_trivially_destructible
+# if defined(__has_builtin)
+#  if __has_builtin(__is_trivially_destructible)
+#   define FT_TRIVIALLY_DESTRUCTIBLE(T) __is_trivially_destructible(T)
+#  endif
+# endif
+# ifndef FT_TRIVIALLY_DESTRUCTIBLE
+#  define FT_TRIVIALLY_DESTRUCTIBLE(T) __has_trivial_destructor(T)
+# endif
+		: public integral_constant<bool, FT_TRIVIALLY_DESTRUCTIBLE(T)> { };
 }
@@ -6,7 +6,7 @@
 /*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/12/08 17:27:55 by moabid            #+#    #+#             */
-/*   Updated: 2022/12/14 15:43:52 by moabid           ###   ########.fr       */
+/*   Updated: 2026/10/21 22:42:44 by moabid           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -60,6 +60,8 @@ namespace ft
     * - Non-member function overloads:
     * relational operators: Relational operators for vector
     * swap:                 Exchange contents of two vectors
+    * erase_if:             Erase the elements matching a predicate
+    * erase_indices:        Erase the elements at sorted positions
     * ------------------------------------------------------------- *
     */
 	template<class T, class Allocator = std::allocator<T> >
@@ -167,16 +169,40 @@ namespace ft
 	
             /* ------------------------------------------------------------- */
             /**
-            *   Assigns a vector to this vecto using the assign method.
+            *   Assigns a vector to this vector. When x fits in the current
+            *   capacity the storage is kept: existing elements are assigned,
+            *   missing ones constructed and extra ones destroyed.
             *   
             *   @param x        The vector that will be assigned.
             */
             /* ------------------------------------------------------------- */
 			
 			vector& operator=( const vector& x ) {
-				if (*this == x)
+				if (this == &x)
 					return (*this);
-				assign(x.begin(), x.end());
+				if (x._size > _cap) {
+					pointer		tmp = _pallocate(x._size);
+					size_type	i = 0;
+					try {
+						for ( ; i < x._size; i++)
+							_alloc.construct(tmp + i, x._begin[i]);
+					}
+					catch(...) {
+						while (i != 0)
+							_alloc.destroy(tmp + --i);
+						_alloc.deallocate(tmp, x._size);
+						throw;
+					}
+					_vdeallocate();
+					_begin = tmp; _size = x._size; _cap = x._size;
+					return *this;
+				}
+				for (size_type i = 0; i < _size && i < x._size; i++)
+					_begin[i] = x._begin[i];
+				for ( ; _size < x._size; _size++)
+					_alloc.construct(_begin + _size, x._begin[_size]);
+				while (_size > x._size)
+					_vdestroy(_begin + _size - 1);
 				return *this;
 			}
 	
@@ -384,11 +410,7 @@ namespace ft
             */
             /* ------------------------------------------------------------- */
 
-			void	clear() {
-				for (; _size != 0; --_size) {
-					_alloc.destroy(_begin + _size - 1);
-				}
-			}
+			void	clear() { _destroy_tail(0); }
             
 			/* ------------------------------------------------------------- */
 			
@@ -482,25 +504,19 @@ namespace ft
 			}
 			/* ------------------------------------------------------------- */
 
+			// Shifts the tail down by assignment, then destroys what is left
+			// at the end in one pass
 			iterator	erase(iterator first, iterator last) {
-				iterator	end(_begin + _size);
-	
+				pointer	out = first.base();
+				pointer	in = last.base();
+
 				if (first != last) {
-					try	{
-						for (iterator tmp = first; tmp != last; tmp++)
-							_vdestroy(&(*tmp));
-						for (iterator tmp = first; last != end; last++, tmp++) {
-							_alloc.construct(&(*tmp), *last);
-							_alloc.destroy(&(*last));
-						}
-					}
-					catch(...) {
-						_vdeallocate();
-					}
+					for (pointer end = _begin + _size; in != end; ++in, ++out)
+						*out = *in;
+					_destroy_tail(static_cast<size_type>(out - _begin));
 				}
 				return first;
 			}
-			
 			/* ------------------------------------------------------------- */
 			
 			void push_back (const value_type& val) {
@@ -525,10 +541,8 @@ namespace ft
 			/* ------------------------------------------------------------- */
 
 			void	resize(size_type n, value_type val = value_type()) {
-				if (n < _size) {
-					while (_size != n)
-						_vdestroy(_begin + _size - 1);
-				}
+				if (n < _size)
+					_destroy_tail(n);
 				else if (n > _size) {
 					reserve(n);
 					for ( ; _size != n; _size++)
@@ -539,11 +553,10 @@ namespace ft
 			/* ------------------------------------------------------------- */
 			
 			void	swap( vector& x ) {
-				if (*this != x) {
-					ft::swap(_begin, x._begin);
-					ft::swap(_cap, x._cap);
-					ft::swap(_size, x._size);
-				}
+				ft::swap(_alloc, x._alloc);
+				ft::swap(_begin, x._begin);
+				ft::swap(_cap, x._cap);
+				ft::swap(_size, x._size);
 			}
 	
             /* ------------------------------------------------------------- */
@@ -599,6 +612,17 @@ namespace ft
 
 			/* ------------------------------------------------------------- */
 
+			// Destroys the elements from n on, nothing to run when T has a
+			// trivial destructor
+			void	_destroy_tail(size_type n) {
+				if (!ft::is_trivially_destructible<value_type>::value)
+					for (size_type i = n; i < _size; i++)
+						_alloc.destroy(_begin + i);
+				_size = n;
+			}
+
+			/* ------------------------------------------------------------- */
+
 			template <class InputIterator>
 			void	_assignrange(InputIterator first, InputIterator last, random_access_iterator_tag) {
 				size_type	count = ft::distance(first, last);
@@ -674,6 +698,72 @@ namespace ft
 		x.swap(y);
 	}
 
+    /* ------------------------------------------------------------- */
+    /**
+    *   Erases every element matching pred in one pass: the kept ones
+    *   are assigned down over the gaps, in order, and the tail is
+    *   destroyed once. Returns the number of erased elements.
+    */
+    /* ------------------------------------------------------------- */
+
+	template <class T, class Alloc, class Predicate>
+	typename vector<T, Alloc>::size_type	erase_if(vector<T, Alloc>& v, Predicate pred) {
+		typename vector<T, Alloc>::iterator	out = v.begin();
+		typename vector<T, Alloc>::iterator	end = v.end();
+		typename vector<T, Alloc>::iterator	in;
+
+		while (out != end && !pred(*out))
+			++out;
+		if (out == end)
+			return 0;
+		for (in = out + 1; in != end; ++in) {
+			if (!pred(*in)) {
+				*out = *in;
+				++out;
+			}
+		}
+		v.erase(out, end);
+		return static_cast<typename vector<T, Alloc>::size_type>(end - out);
+	}
+
+    /* ------------------------------------------------------------- */
+    /**
+    *   Erases the elements at the positions in [first, last), sorted in
+    *   ascending order (repeats are ignored), in the same single pass.
+    *   The positions are checked before anything moves: out_of_range
+    *   past the end, invalid_argument if they are not sorted.
+    *   Returns the number of erased elements.
+    */
+    /* ------------------------------------------------------------- */
+
+	template <class T, class Alloc, class ForwardIterator>
+	typename vector<T, Alloc>::size_type	erase_indices(vector<T, Alloc>& v, ForwardIterator first, ForwardIterator last) {
+		typedef typename vector<T, Alloc>::size_type	size_type;
+		size_type	n = v.size();
+		size_type	out;
+		size_type	in;
+
+		if (first == last)
+			return 0;
+		for (ForwardIterator it = first, prev = first; it != last; prev = it++) {
+			if (static_cast<size_type>(*it) >= n)
+				throw std::out_of_range("ft::vector");
+			if (*it < *prev)
+				throw std::invalid_argument("ft::vector");
+		}
+		out = in = static_cast<size_type>(*first);
+		for ( ; first != last; ++first) {
+			for (size_type next = static_cast<size_type>(*first); in < next; ++in, ++out)
+				v[out] = v[in];
+			if (in == static_cast<size_type>(*first))
+				++in;
+		}
+		for ( ; in < n; ++in, ++out)
+			v[out] = v[in];
+		v.erase(v.begin() + out, v.end());
+		return n - out;
+	}
+
     /* ------------------------------------------------------------- */
     /**
     *   Relational operators
@@ -710,3 +800,5 @@ namespace ft
 		return !(lhs < rhs);
 	}
 }
+
+# include "vector_bool.hpp"
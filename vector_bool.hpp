@@ -0,0 +1,538 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   vector_bool.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: moabid <moabid@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 03:52:11 by moabid            #+#    #+#             */
+/*   Updated: 2026/10/21 11:32:22 by moabid           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+# include <cstring>
+# include <limits>
+# include <stdexcept>
+# include "vector.hpp"
+# include "simd.hpp"
+# include "iterators/BitIterator.hpp"
+
+namespace ft
+{
+	/**
+    * ------------------------------------------------------------- *
+    * --------------------- FT::VECTOR<BOOL> ---------------------- *
+    *
+    * The vector interface over bits packed 64 to a word, one eighth
+    * of the memory of a byte per flag. operator[] and iterators
+    * hand out ft::BitReference proxies; capacity is counted in bits.
+    * Storage past size() is kept zeroed, so whole words can be
+    * counted, searched and compared without masking.
+    *
+    * - Bit operations:
+    * count:                Number of set bits, popcount per word
+    * rank:                 Number of set bits before a position
+    * any, none, all:       Whether some, no or every bit is set
+    * find_first:           Index of the first set bit, size() if none
+    * find_next:            Index of the first set bit after pos
+    * flip:                 Invert every bit, or one (on the reference)
+    * &=, |=, ^=:           Word-wise operations between vectors of the
+    *                       same size (std::invalid_argument otherwise)
+    * intersects:           Whether (*this & x).any(), without a copy
+    * words:                The packed words, word_count() of them
+    *
+    * - Non-member function overloads:
+    * &, |, ^:              Bitwise operations into a new vector
+    * operator==:           Compares whole words
+    * ------------------------------------------------------------- *
+    */
+	template <class Allocator>
+	class vector<bool, Allocator>
+	{
+		public:
+			/* ------------------------------------------------------------- */
+    	    /* -------------------------- ALIASES -------------------------- */
+			typedef	bool										value_type;
+			typedef	Allocator									allocator_type;
+			typedef	typename allocator_type::size_type			size_type;
+			typedef typename allocator_type::difference_type	difference_type;
+			typedef	ft::BitReference							reference;
+			typedef	bool										const_reference;
+			typedef	ft::BitIterator								iterator;
+			typedef	ft::BitConstIterator						const_iterator;
+			typedef	ft::reverse_iterator<iterator>				reverse_iterator;
+			typedef	ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+			typedef	ft::bit_word								word_type;
+
+			static const size_type	word_bits = ft::bit_word_bits;
+
+		protected:
+			typedef typename Allocator::template rebind<word_type>::other	word_allocator;
+
+    	    /* ------------------------------------------------------------- */
+    	    /* ------------------------- ATTRIBUTES ------------------------ */
+			size_type		_size;
+			size_type		_cap;
+			word_type*		_begin;
+			word_allocator	_alloc;
+
+		public:
+    	    /* ------------------------------------------------------------- */
+    	    /* ---------------------------- BODY --------------------------- */
+
+			explicit vector(const allocator_type& alloc = allocator_type())
+				: _size(0), _cap(0), _begin(NULL), _alloc(alloc) { }
+
+			explicit vector(size_type n, const value_type& val = value_type(),
+							const allocator_type& alloc = allocator_type())
+				: _size(0), _cap(0), _begin(NULL), _alloc(alloc) {
+				resize(n, val);
+			}
+
+			template <class InputIterator>
+			vector(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type * = NULL)
+				: _size(0), _cap(0), _begin(NULL), _alloc(alloc) {
+				assign(first, last);
+			}
+
+			vector(const vector& x) : _size(0), _cap(0), _begin(NULL), _alloc(x._alloc) {
+				*this = x;
+			}
+
+			~vector() {
+				if (_begin != NULL)
+					_alloc.deallocate(_begin, _cap);
+			}
+
+			vector&	operator=(const vector& x) {
+				if (this != &x) {
+					clear();
+					reserve(x._size);
+					if (x._size != 0)
+						std::memcpy(_begin, x._begin, _nwords(x._size) * sizeof(word_type));
+					_size = x._size;
+				}
+				return *this;
+			}
+
+			void	assign(size_type n, const value_type& val) {
+				clear();
+				resize(n, val);
+			}
+
+			template <class InputIterator>
+			void	assign(InputIterator first, InputIterator last,
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type * = NULL) {
+				clear();
+				_reserve_range(first, last, typename iterator_traits<InputIterator>::iterator_category());
+				for ( ; first != last; ++first)
+					push_back(*first);
+			}
+
+			allocator_type	get_allocator() const { return allocator_type(_alloc); }
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Element access, bits are read as bool and written through
+            *   a reference proxy.
+            */
+            /* ------------------------------------------------------------- */
+
+			reference	at(size_type pos) {
+				if (pos >= size())
+					throw std::out_of_range("ft::vector");
+				return (*this)[pos];
+			}
+
+			const_reference	at(size_type pos) const {
+				if (pos >= size())
+					throw std::out_of_range("ft::vector");
+				return (*this)[pos];
+			}
+
+			reference		operator[](size_type pos) {
+				return reference(_begin + pos / word_bits, static_cast<unsigned>(pos % word_bits));
+			}
+			const_reference	operator[](size_type pos) const { return (_begin[pos / word_bits] >> (pos % word_bits)) & 1; }
+			reference		front()							{ return (*this)[0]; }
+			const_reference	front() const					{ return (*this)[0]; }
+			reference		back()							{ return (*this)[_size - 1]; }
+			const_reference	back() const					{ return (*this)[_size - 1]; }
+
+			const word_type*	words() const				{ return _begin; }
+			size_type			word_count() const			{ return _nwords(_size); }
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Iterators
+            */
+            /* ------------------------------------------------------------- */
+
+			iterator				begin()			{ return iterator(_begin, 0); }
+			const_iterator			begin() const	{ return const_iterator(_begin, 0); }
+			iterator				end()			{ return begin() + difference_type(_size); }
+			const_iterator			end() const		{ return begin() + difference_type(_size); }
+			reverse_iterator		rbegin()		{ return reverse_iterator(end()); }
+			const_reverse_iterator	rbegin() const	{ return const_reverse_iterator(end()); }
+			reverse_iterator		rend()			{ return reverse_iterator(begin()); }
+			const_reverse_iterator	rend() const	{ return const_reverse_iterator(begin()); }
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Capacity, in bits.
+            */
+            /* ------------------------------------------------------------- */
+
+			bool		empty() const		{ return _size == 0; }
+			size_type	size() const		{ return _size; }
+			size_type	capacity() const	{ return _cap * word_bits; }
+
+			size_type	max_size() const {
+				size_type	_amax = _alloc.max_size();
+				size_type	_nmax = std::numeric_limits<size_type>::max() / 2;
+
+				if (_amax < _nmax / word_bits)
+					return _amax * word_bits;
+				return _nmax;
+			}
+
+			void	reserve(size_type new_cap) {
+				if (new_cap > max_size())
+					throw std::length_error("ft::vector");
+				if (_nwords(new_cap) > _cap)
+					_reallocate(_nwords(new_cap));
+			}
+
+            /* ------------------------------------------------------------- */
+            /**
+            *     Modifiers
+            */
+            /* ------------------------------------------------------------- */
+
+			void	clear() {
+				if (_size != 0)
+					std::memset(_begin, 0, _nwords(_size) * sizeof(word_type));
+				_size = 0;
+			}
+
+			void	push_back(const value_type& val) {
+				if (_size == capacity())
+					reserve(_size ? _size * 2 : word_bits);
+				if (val)
+					_begin[_size / word_bits] |= word_type(1) << (_size % word_bits);
+				_size++;
+			}
+
+			void	pop_back() {
+				if (_size != 0) {
+					_size--;
+					_begin[_size / word_bits] &= ~(word_type(1) << (_size % word_bits));
+				}
+			}
+
+			void	resize(size_type n, value_type val = value_type()) {
+				if (n < _size) {
+					_fill(n, _size, false);
+					_size = n;
+				}
+				else if (n > _size) {
+					reserve(n);
+					if (val)
+						_fill(_size, n, true);
+					_size = n;
+				}
+			}
+
+			iterator	insert(iterator position, const value_type& val) {
+				size_type	pos = static_cast<size_type>(position - begin());
+
+				_open(pos, 1);
+				(*this)[pos] = val;
+				return begin() + difference_type(pos);
+			}
+
+			void	insert(iterator position, size_type n, const value_type& val) {
+				size_type	pos = static_cast<size_type>(position - begin());
+
+				_open(pos, n);
+				_fill(pos, pos + n, val);
+			}
+
+			template <class InputIterator>
+			void	insert(iterator position, InputIterator first, InputIterator last,
+						typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type * = NULL) {
+				size_type	pos = static_cast<size_type>(position - begin());
+				vector		bits(first, last, get_allocator());
+
+				_open(pos, bits._size);
+				for (size_type i = 0; i < bits._size; i += word_bits) {
+					unsigned	k = _chunk(bits._size - i);
+
+					_write(pos + i, bits._read(i, k), k);
+				}
+			}
+
+			iterator	erase(iterator position) { return erase(position, position + 1); }
+
+			iterator	erase(iterator first, iterator last) {
+				size_type	from = static_cast<size_type>(first - begin());
+				size_type	to = static_cast<size_type>(last - begin());
+
+				if (from != to) {
+					_move(from, to, _size - to);
+					_fill(_size - (to - from), _size, false);
+					_size -= to - from;
+				}
+				return begin() + difference_type(from);
+			}
+
+			void	swap(vector& x) {
+				ft::swap(_alloc, x._alloc);
+				ft::swap(_begin, x._begin);
+				ft::swap(_cap, x._cap);
+				ft::swap(_size, x._size);
+			}
+
+			static void	swap(reference x, reference y) {
+				bool	tmp = x;
+
+				x = y;
+				y = tmp;
+			}
+
+            /* ------------------------------------------------------------- */
+            /**
+            *   Bit operations, a word at a time. Bits past size() are
+            *   zero, so the last word needs no mask.
+            */
+            /* ------------------------------------------------------------- */
+
+			size_type	count() const { return ft::simd::popcount(_begin, _nwords(_size)); }
+
+			size_type	rank(size_type pos) const {
+				size_type	w = pos / word_bits;
+				size_type	n = ft::simd::popcount(_begin, w);
+
+				if (pos % word_bits)
+					n += __builtin_popcountll(_begin[w] & _low(static_cast<unsigned>(pos % word_bits)));
+				return n;
+			}
+
+			bool	any() const {
+				for (size_type i = 0, n = _nwords(_size); i < n; i++)
+					if (_begin[i] != 0)
+						return true;
+				return false;
+			}
+
+			bool	none() const { return !any(); }
+			bool	all() const { return count() == _size; }
+
+			size_type	find_first() const { return _find(0); }
+			size_type	find_next(size_type pos) const { return pos + 1 < _size ? _find(pos + 1) : _size; }
+
+			void	flip() {
+				size_type	n = _nwords(_size);
+
+				for (size_type i = 0; i < n; i++)
+					_begin[i] = ~_begin[i];
+				if (_size % word_bits)
+					_begin[n - 1] &= _low(static_cast<unsigned>(_size % word_bits));
+			}
+
+			vector&	operator&=(const vector& x) {
+				_same_size(x);
+				for (size_type i = 0, n = _nwords(_size); i < n; i++)
+					_begin[i] &= x._begin[i];
+				return *this;
+			}
+
+			vector&	operator|=(const vector& x) {
+				_same_size(x);
+				for (size_type i = 0, n = _nwords(_size); i < n; i++)
+					_begin[i] |= x._begin[i];
+				return *this;
+			}
+
+			vector&	operator^=(const vector& x) {
+				_same_size(x);
+				for (size_type i = 0, n = _nwords(_size); i < n; i++)
+					_begin[i] ^= x._begin[i];
+				return *this;
+			}
+
+			bool	intersects(const vector& x) const {
+				_same_size(x);
+				for (size_type i = 0, n = _nwords(_size); i < n; i++)
+					if (_begin[i] & x._begin[i])
+						return true;
+				return false;
+			}
+
+            /* ------------------------------------------------------------- */
+            /**
+            *      PRIVATE Utils functions
+            */
+            /* ------------------------------------------------------------- */
+		private:
+			static size_type	_nwords(size_type bits) { return (bits + word_bits - 1) / word_bits; }
+			static unsigned		_chunk(size_type left) { return left < word_bits ? static_cast<unsigned>(left) : word_bits; }
+				// The k low bits set, k < 64
+			static word_type	_low(unsigned k) { return (word_type(1) << k) - 1; }
+
+			/* ------------------------------------------------------------- */
+
+				// Moves to a buffer of n words, zeroed past the copied ones
+			void	_reallocate(size_type n) {
+				word_type*	tmp = _alloc.allocate(n);
+				size_type	used = _nwords(_size);
+
+				if (used != 0)
+					std::memcpy(tmp, _begin, used * sizeof(word_type));
+				std::memset(tmp + used, 0, (n - used) * sizeof(word_type));
+				if (_begin != NULL)
+					_alloc.deallocate(_begin, _cap);
+				_begin = tmp;
+				_cap = n;
+			}
+
+			/* ------------------------------------------------------------- */
+
+			template <class InputIterator>
+			void	_reserve_range(InputIterator first, InputIterator last, forward_iterator_tag) {
+				reserve(static_cast<size_type>(ft::distance(first, last)));
+			}
+
+			template <class InputIterator>
+			void	_reserve_range(InputIterator, InputIterator, input_iterator_tag) { }
+
+			/* ------------------------------------------------------------- */
+
+			void	_same_size(const vector& x) const {
+				if (x._size != _size)
+					throw std::invalid_argument("ft::vector");
+			}
+
+			/* ------------------------------------------------------------- */
+
+				// First set bit at or after pos, _size if there is none
+			size_type	_find(size_type pos) const {
+				size_type	n = _nwords(_size);
+				size_type	w = pos / word_bits;
+				word_type	x;
+
+				if (w >= n)
+					return _size;
+				x = _begin[w] & ~_low(static_cast<unsigned>(pos % word_bits));
+				while (x == 0) {
+					if (++w == n)
+						return _size;
+					x = _begin[w];
+				}
+				return w * word_bits + static_cast<size_type>(__builtin_ctzll(x));
+			}
+
+			/* ------------------------------------------------------------- */
+
+			void	_fill(size_type first, size_type last, bool val) {
+				for ( ; first < last && first % word_bits; first++)
+					(*this)[first] = val;
+				if (last - first >= word_bits) {
+					size_type	words = (last - first) / word_bits;
+
+					std::memset(_begin + first / word_bits, val ? 0xff : 0, words * sizeof(word_type));
+					first += words * word_bits;
+				}
+				for ( ; first < last; first++)
+					(*this)[first] = val;
+			}
+
+			/* ------------------------------------------------------------- */
+
+				// The k <= 64 bits from pos, in the low bits of a word
+			word_type	_read(size_type pos, unsigned k) const {
+				size_type	w = pos / word_bits;
+				unsigned	b = static_cast<unsigned>(pos % word_bits);
+				word_type	x = _begin[w] >> b;
+
+				if (b != 0 && b + k > word_bits)
+					x |= _begin[w + 1] << (word_bits - b);
+				return k == word_bits ? x : x & _low(k);
+			}
+
+				// Stores the k <= 64 low bits of x from pos
+			void	_write(size_type pos, word_type x, unsigned k) {
+				size_type	w = pos / word_bits;
+				unsigned	b = static_cast<unsigned>(pos % word_bits);
+				word_type	mask = k == word_bits ? ~word_type(0) : _low(k);
+
+				_begin[w] = (_begin[w] & ~(mask << b)) | (x << b);
+				if (b != 0 && b + k > word_bits)
+					_begin[w + 1] = (_begin[w + 1] & ~(mask >> (word_bits - b))) | (x >> (word_bits - b));
+			}
+
+				// memmove for n bits, 64 at a time
+			void	_move(size_type dst, size_type src, size_type n) {
+				if (dst < src) {
+					for (size_type i = 0; i < n; i += word_bits) {
+						unsigned	k = _chunk(n - i);
+
+						_write(dst + i, _read(src + i, k), k);
+					}
+				}
+				else if (dst > src) {
+					for (size_type i = n; i > 0; ) {
+						unsigned	k = _chunk(i);
+
+						i -= k;
+						_write(dst + i, _read(src + i, k), k);
+					}
+				}
+			}
+
+				// Makes room for n bits at pos, zeroed
+			void	_open(size_type pos, size_type n) {
+				if (_size + n > capacity())
+					reserve(_size + n > _size * 2 ? _size + n : _size * 2);
+				_move(pos + n, pos, _size - pos);
+				_fill(pos, pos + n < _size ? pos + n : _size, false);
+				_size += n;
+			}
+	};
+
+    /* ------------------------------------------------------------- */
+    /**
+    *   Bitwise operators and word comparison
+    */
+    /* ------------------------------------------------------------- */
+
+	template <class Alloc>
+	vector<bool, Alloc>	operator&(const vector<bool, Alloc>& x, const vector<bool, Alloc>& y) {
+		vector<bool, Alloc>	res(x);
+
+		return res &= y;
+	}
+
+	template <class Alloc>
+	vector<bool, Alloc>	operator|(const vector<bool, Alloc>& x, const vector<bool, Alloc>& y) {
+		vector<bool, Alloc>	res(x);
+
+		return res |= y;
+	}
+
+	template <class Alloc>
+	vector<bool, Alloc>	operator^(const vector<bool, Alloc>& x, const vector<bool, Alloc>& y) {
+		vector<bool, Alloc>	res(x);
+
+		return res ^= y;
+	}
+
+	template <class Alloc>
+	bool	operator==(const vector<bool, Alloc>& lhs, const vector<bool, Alloc>& rhs) {
+		return lhs.size() == rhs.size()
+			&& (lhs.empty() || std::memcmp(lhs.words(), rhs.words(), lhs.word_count() * sizeof(ft::bit_word)) == 0);
+	}
+}